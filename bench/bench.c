@@ -0,0 +1,582 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <gio/gio.h>
+#include <glib/gstdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifdef __linux__
+# include <linux/perf_event.h>
+# include <sys/syscall.h>
+#endif // __linux__
+
+#define THROW_ERRNO(what) \
+  G_STMT_START { \
+    int __errsv = errno; \
+    g_set_error \
+    (error, \
+     G_IO_ERROR, \
+     g_io_error_from_errno (__errsv), \
+     "%s: %s", \
+      (what), \
+      g_strerror (__errsv)); \
+    return FALSE; \
+  } G_STMT_END
+
+#define n_counters (G_N_ELEMENTS (counters))
+
+static const struct
+{
+  const gchar* name;
+  guint32 config;
+} counters [] =
+{
+#ifdef __linux__
+  { "cycles", PERF_COUNT_HW_CPU_CYCLES, },
+  { "instructions", PERF_COUNT_HW_INSTRUCTIONS, },
+  { "branch-misses", PERF_COUNT_HW_BRANCH_MISSES, },
+  { "cache-misses", PERF_COUNT_HW_CACHE_MISSES, },
+#else // !__linux__
+  { NULL, 0, },
+#endif // __linux__
+};
+
+typedef struct
+{
+  gint status;
+  gint64 wall;
+  gint64 user;
+  gint64 sys;
+  glong maxrss;
+  guint64 written;
+  gchar* digest;
+  gboolean counted;
+  guint64 counts [n_counters];
+} Sample;
+
+static void
+_perf_open (gint* fds, pid_t pid)
+{
+  guint i;
+
+  for (i = 0; i < n_counters; ++i)
+    fds [i] = -1;
+#ifdef __linux__
+  /*
+   * Counters follow the child from the exec on, so the
+   * harness (and bfc's own startup code) is not counted;
+   * kernel time is left out so unprivileged users
+   * (perf_event_paranoid up to 2) can count too
+   *
+   */
+  for (i = 0; i < n_counters; ++i)
+  {
+    struct perf_event_attr attr = {0};
+      attr.size = sizeof (attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = counters [i].config;
+      attr.disabled = 1;
+      attr.enable_on_exec = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+    fds [i] = syscall (SYS_perf_event_open, &attr, pid, -1, -1, PERF_FLAG_FD_CLOEXEC);
+  }
+#endif // __linux__
+}
+
+static gboolean
+_perf_read (gint* fds, guint64* counts)
+{
+  gboolean good = TRUE;
+  guint i;
+
+  for (i = 0; i < n_counters; ++i)
+  {
+    if (fds [i] < 0 || read (fds [i], & counts [i], sizeof (counts [i])) != sizeof (counts [i]))
+      good = FALSE;
+    if (fds [i] >= 0)
+      close (fds [i]);
+  }
+return good;
+}
+
+static gboolean
+_spawn (gchar** argv, const gchar* input, gboolean capture, gboolean count, Sample* sample, GError** error)
+{
+  GChecksum* checksum = NULL;
+  gint fds [n_counters];
+  gint outpipe [2] = { -1, -1, };
+  gint gopipe [2] = { -1, -1, };
+  struct rusage usage;
+  gint64 start;
+  gint status;
+  pid_t pid;
+
+  memset (sample, 0, sizeof (*sample));
+
+  if (pipe (gopipe) < 0)
+    THROW_ERRNO ("pipe ()");
+  if (capture && pipe (outpipe) < 0)
+  {
+    int errsv = errno;
+    close (gopipe [0]);
+    close (gopipe [1]);
+    errno = errsv;
+    THROW_ERRNO ("pipe ()");
+  }
+
+  start = g_get_monotonic_time ();
+
+  if ((pid = fork ()) == 0)
+  {
+    gchar go;
+    gint fd;
+
+    /*
+     * Holds still until the parent has its counters
+     * on this process, which start with the exec
+     *
+     */
+    close (gopipe [1]);
+    if (read (gopipe [0], &go, 1) != 1)
+      _exit (127);
+    close (gopipe [0]);
+
+    if ((fd = open (input == NULL ? "/dev/null" : input, O_RDONLY)) < 0)
+      _exit (127);
+    dup2 (fd, STDIN_FILENO);
+    close (fd);
+
+    if (capture)
+    {
+      close (outpipe [0]);
+      dup2 (outpipe [1], STDOUT_FILENO);
+      close (outpipe [1]);
+    }
+    else
+    {
+      if ((fd = open ("/dev/null", O_WRONLY)) < 0)
+        _exit (127);
+      dup2 (fd, STDOUT_FILENO);
+      close (fd);
+    }
+
+    execvp (argv [0], argv);
+    _exit (127);
+  }
+  else if (pid < 0)
+  {
+    int errsv = errno;
+    if (capture)
+    {
+      close (outpipe [0]);
+      close (outpipe [1]);
+    }
+    close (gopipe [0]);
+    close (gopipe [1]);
+    errno = errsv;
+    THROW_ERRNO ("fork ()");
+  }
+
+  close (gopipe [0]);
+  if (count)
+    _perf_open (fds, pid);
+  if (write (gopipe [1], "", 1) != 1)
+    g_warning ("(%s): write (): %s", G_STRLOC, g_strerror (errno));
+  close (gopipe [1]);
+
+  if (capture)
+  {
+    guchar buffer [65536];
+    gssize read_;
+
+    /*
+     * Programs are read out as they write, so a
+     * full pipe never stalls them; only a digest
+     * is kept to compare runs against each other
+     *
+     */
+    close (outpipe [1]);
+    checksum = g_checksum_new (G_CHECKSUM_SHA256);
+
+    while ((read_ = read (outpipe [0], buffer, sizeof (buffer))) != 0)
+    {
+      if (read_ < 0 && errno == EINTR)
+        continue;
+      if (read_ < 0)
+        break;
+
+      g_checksum_update (checksum, buffer, read_);
+      sample->written += read_;
+    }
+
+    close (outpipe [0]);
+    sample->digest = g_strdup (g_checksum_get_string (checksum));
+    g_checksum_free (checksum);
+  }
+
+  while (wait4 (pid, &status, 0, &usage) < 0)
+  {
+    if (errno != EINTR)
+      THROW_ERRNO ("wait4 ()");
+  }
+
+  sample->wall = g_get_monotonic_time () - start;
+  sample->user = usage.ru_utime.tv_sec * G_USEC_PER_SEC + usage.ru_utime.tv_usec;
+  sample->sys = usage.ru_stime.tv_sec * G_USEC_PER_SEC + usage.ru_stime.tv_usec;
+  sample->maxrss = usage.ru_maxrss;
+  sample->status = WIFEXITED (status) ? WEXITSTATUS (status) : 128 + WTERMSIG (status);
+
+  if (count)
+    sample->counted = _perf_read (fds, sample->counts);
+return TRUE;
+}
+
+static void
+_json_string (GString* json, const gchar* value)
+{
+  const gchar* p;
+
+  g_string_append_c (json, '\"');
+
+  for (p = value; *p != 0; p++)
+  {
+    if (*p == '\"' || *p == '\\')
+      g_string_append_printf (json, "\\%c", *p);
+    else
+    if ((guchar) *p < 0x20)
+      g_string_append_printf (json, "\\u%04x", (guint) *p);
+    else
+      g_string_append_c (json, *p);
+  }
+
+  g_string_append_c (json, '\"');
+}
+
+static void
+_json_sample (GString* json, const Sample* sample, guint64 size)
+{
+  guint i;
+
+  g_string_append_printf (json, "{ \"status\": %i", sample->status);
+  g_string_append_printf (json, ", \"wall-us\": %" G_GINT64_FORMAT, sample->wall);
+  g_string_append_printf (json, ", \"user-us\": %" G_GINT64_FORMAT, sample->user);
+  g_string_append_printf (json, ", \"sys-us\": %" G_GINT64_FORMAT, sample->sys);
+  g_string_append_printf (json, ", \"max-rss-kb\": %li", sample->maxrss);
+
+  if (sample->digest == NULL)
+    g_string_append_printf (json, ", \"size\": %" G_GUINT64_FORMAT, size);
+  else
+  {
+    g_string_append_printf (json, ", \"output-bytes\": %" G_GUINT64_FORMAT, sample->written);
+    g_string_append (json, ", \"output-sha256\": ");
+    _json_string (json, sample->digest);
+    g_string_append (json, ", \"counters\": ");
+
+    if (!sample->counted)
+      g_string_append (json, "null");
+    else
+    {
+      g_string_append (json, "{ ");
+
+      for (i = 0; i < n_counters; ++i)
+        g_string_append_printf (json, "%s\"%s\": %" G_GUINT64_FORMAT, i == 0 ? "" : ", ", counters [i].name, sample->counts [i]);
+
+      g_string_append (json, " }");
+    }
+  }
+
+  g_string_append (json, " }");
+}
+
+static gboolean
+_bench (GString* json, const gchar* bfc, const gchar* program, const gchar* options, const gchar* workdir, gint repeat, gboolean* first, GHashTable* digests, GError** error)
+{
+  gboolean good = FALSE;
+  gchar** argv = NULL;
+  gchar* base = NULL;
+  gchar* input = NULL;
+  gchar* output = NULL;
+  gchar* stem = NULL;
+  gchar* run [2] = { NULL, NULL, };
+  const gchar* expected = NULL;
+  GStatBuf buf;
+  Sample best = {0};
+  Sample compile = {0};
+  Sample sample;
+  gint argc, i;
+
+  /*
+   * An empty set stands for bfc's defaults, which
+   * g_shell_parse_argv would take for an error
+   *
+   */
+  if (*options == 0)
+  {
+    argv = g_new0 (gchar*, 1);
+    argc = 0;
+  }
+  else
+  if (!g_shell_parse_argv (options, &argc, &argv, error))
+    return FALSE;
+
+  base = g_path_get_basename (program);
+  stem = g_str_has_suffix (base, ".b") ? g_strndup (base, strlen (base) - 2) : g_strdup (base);
+  output = g_build_filename (workdir, stem, NULL);
+
+  /*
+   * A program's input, if any, sits next to
+   * it as program.in (for program.b)
+   *
+   */
+  if (g_str_has_suffix (program, ".b"))
+    input = g_strdup_printf ("%.*sin", (gint) strlen (program) - 1, program);
+  else
+    input = g_strconcat (program, ".in", NULL);
+
+  if (!g_file_test (input, G_FILE_TEST_IS_REGULAR))
+    g_clear_pointer (&input, g_free);
+
+  /*
+   * bfc [options] -o output program
+   *
+   */
+  argv = g_renew (gchar*, argv, argc + 5);
+  memmove (& argv [1], & argv [0], (argc + 1) * sizeof (gchar*));
+  argv [0] = g_strdup (bfc);
+  argv [argc + 1] = g_strdup ("-o");
+  argv [argc + 2] = g_strdup (output);
+  argv [argc + 3] = g_strdup (program);
+  argv [argc + 4] = NULL;
+
+  g_unlink (output);
+
+  if (!_spawn (argv, NULL, FALSE, FALSE, &compile, error))
+    goto done;
+
+  if (*first == FALSE)
+    g_string_append (json, ",\n");
+  *first = FALSE;
+
+  g_string_append (json, "    { \"program\": ");
+  _json_string (json, stem);
+  g_string_append (json, ", \"options\": ");
+  _json_string (json, options);
+  g_string_append (json, ",\n      \"compile\": ");
+  _json_sample (json, &compile, g_stat (output, &buf) < 0 ? 0 : buf.st_size);
+  g_string_append (json, ",\n      \"run\": ");
+
+  if (compile.status != 0)
+  {
+    g_warning ("%s: bfc %s exited with status %i", program, options, compile.status);
+    g_string_append (json, "null }");
+    good = TRUE;
+    goto done;
+  }
+
+  /*
+   * The fastest of the runs stands for the lot,
+   * counters included, as the least disturbed one
+   *
+   */
+  run [0] = output;
+
+  for (i = 0; i < repeat; ++i)
+  {
+    if (!_spawn (run, input, TRUE, TRUE, &sample, error))
+      goto done;
+    if (i == 0 || sample.wall < best.wall)
+    {
+      g_free (best.digest);
+      best = sample;
+    }
+    else
+      g_free (sample.digest);
+  }
+
+  _json_sample (json, &best, 0);
+  g_string_append (json, " }");
+
+  /*
+   * Every option set must agree on what a program
+   * writes; a mismatch is a miscompilation
+   *
+   */
+  if ((expected = g_hash_table_lookup (digests, program)) == NULL)
+    g_hash_table_insert (digests, g_strdup (program), g_strdup (best.digest));
+  else
+  if (g_strcmp0 (expected, best.digest))
+    g_warning ("%s: output with %s differs from the first option set's", program, options);
+
+  if (best.status != 0)
+    g_warning ("%s: program built with %s exited with status %i", program, options, best.status);
+
+  good = TRUE;
+done:
+  g_unlink (output);
+  g_strfreev (argv);
+  g_free (base);
+  g_free (best.digest);
+  g_free (input);
+  g_free (output);
+  g_free (stem);
+return good;
+}
+
+static gint
+_compare (gconstpointer a, gconstpointer b)
+{
+  return g_strcmp0 (* (const gchar**) a, * (const gchar**) b);
+}
+
+static gboolean
+_collect (GPtrArray* programs, const gchar* path, GError** error)
+{
+  const gchar* name;
+  GDir* dir = NULL;
+  guint start = programs->len;
+
+  if (!g_file_test (path, G_FILE_TEST_IS_DIR))
+  {
+    g_ptr_array_add (programs, g_strdup (path));
+    return TRUE;
+  }
+
+  if ((dir = g_dir_open (path, 0, error)) == NULL)
+    return FALSE;
+
+  while ((name = g_dir_read_name (dir)) != NULL)
+  {
+    if (g_str_has_suffix (name, ".b"))
+      g_ptr_array_add (programs, g_build_filename (path, name, NULL));
+  }
+
+  g_dir_close (dir);
+
+  /*
+   * Directory order is whatever the file system
+   * gives; sorting keeps reports comparable
+   *
+   */
+  if (programs->len > start)
+    qsort (& programs->pdata [start], programs->len - start, sizeof (gpointer), _compare);
+return TRUE;
+}
+
+static gint
+_main (gint argc, gchar** argv)
+{
+  GOptionContext* context = NULL;
+  GError* tmperr = NULL;
+
+  const gchar* defaults [] = { "-O0", "-O1", "-O2", "-O3", NULL, };
+  GPtrArray* programs = g_ptr_array_new_with_free_func (g_free);
+  GHashTable* digests = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+  GString* json = g_string_sized_new (4096);
+  gboolean first = TRUE;
+  gchar* workdir = NULL;
+  gint repeat = 3;
+  gint status = 0;
+  gint i, j;
+
+  const gchar* bfc = "bfc";
+  const gchar* output = "-";
+  gchar** options = NULL;
+
+  const GOptionEntry entries[] =
+  {
+    { "bfc", 0, 0, G_OPTION_ARG_FILENAME, &bfc, "Benchmark the compiler at <PATH> (by default, bfc from the search path)", "PATH", },
+    { "options", 0, 0, G_OPTION_ARG_STRING_ARRAY, &options, "Compile every program with <OPTIONS> (repeatable; by default, each of -O0 to -O3)", "OPTIONS", },
+    { "output", 'o', 0, G_OPTION_ARG_FILENAME, &output, "Write the results out to <FILE> as JSON", "FILE", },
+    { "repeat", 'r', 0, G_OPTION_ARG_INT, &repeat, "Run every executable <N> times, keeping the fastest", "N", },
+    { NULL, 0, 0, 0, NULL, NULL, NULL, },
+  };
+
+  context = g_option_context_new ("programs or directories ...");
+  g_option_context_set_summary (context, "Compiles each program with every option set, then runs it, measuring both");
+  g_option_context_add_main_entries (context, entries, NULL);
+  g_option_context_parse (context, &argc, &argv, &tmperr);
+  g_option_context_free (context);
+
+  if (G_LIKELY (tmperr == NULL))
+  {
+    for (i = 1; i < argc && tmperr == NULL; ++i)
+      _collect (programs, argv [i], &tmperr);
+    if (tmperr == NULL && programs->len == 0)
+      g_set_error_literal (&tmperr, G_OPTION_ERROR, G_OPTION_ERROR_BAD_VALUE, "No programs to benchmark");
+    if (tmperr == NULL)
+      workdir = g_dir_make_tmp ("bfc-bench-XXXXXX", &tmperr);
+  }
+
+  if (G_LIKELY (tmperr == NULL))
+  {
+    const gchar* const* sets = options != NULL ? (const gchar* const*) options : defaults;
+
+    g_string_append (json, "{ \"bfc\": ");
+    _json_string (json, bfc);
+    g_string_append_printf (json, ", \"repeat\": %i,\n  \"results\": [\n", MAX (1, repeat));
+
+    for (i = 0; i < programs->len && tmperr == NULL; ++i)
+    for (j = 0; sets [j] != NULL && tmperr == NULL; ++j)
+      _bench (json, bfc, programs->pdata [i], sets [j], workdir, MAX (1, repeat), &first, digests, &tmperr);
+
+    g_string_append (json, "\n  ]\n}\n");
+    g_rmdir (workdir);
+  }
+
+  if (G_LIKELY (tmperr == NULL))
+  {
+    if (!g_strcmp0 (output, "-"))
+      fputs (json->str, stdout);
+    else
+      g_file_set_contents (output, json->str, json->len, &tmperr);
+  }
+
+  if (G_UNLIKELY (tmperr != NULL))
+  {
+    g_warning
+    ("(%s): %s: %i: %s",
+     G_STRLOC,
+     g_quark_to_string
+     (tmperr->domain),
+      tmperr->code,
+      tmperr->message);
+    g_error_free (tmperr);
+    status = -1;
+  }
+
+  g_hash_table_unref (digests);
+  g_ptr_array_unref (programs);
+  g_string_free (json, TRUE);
+  g_strfreev (options);
+  g_free (workdir);
+return status;
+}
+
+int
+main (int argc, char* argv[])
+{
+return _main (argc, argv);
+}
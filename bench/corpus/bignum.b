@@ -0,0 +1,27 @@
+Last 120 decimal digits of Fibonacci number 22501 with a digit per cell
+walking the whole number for every addition
+
+>>>>>>>>+>>+>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>+>>>>>>>>
++[<<<<<<<<]>[-]---------------------------------------------------------
+-------------------------------------------------[>[-]------------------
+------------------------------------------------------------------------
+----------------[>>>>>>[>[->>>+<<<]>[-<+>>>+<<]>[->+<]>[-<<+>>>---------
+-<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<+<[->>+<[-]<]>>[-<<+>>]<<++++++++
+++[-]>[<<<<[-]>>>>>>>>>+<<<<<[-]]<<]>>>>]>>>[-]<<<<<<<<<<<[<<<<<<<<]>>-]
+<-]>>>>>>>[>>>>>>>>]<<<<<<<<[>>[->>+>+<<<]>>>[-<<<+>>>]<++++++++++++++++
+++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<]>>>++++++++++.---------
+-
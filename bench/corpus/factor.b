@@ -0,0 +1,961 @@
+Prime factors of each number read (one per line; up to 24 bits) by
+trial division on binary numbers one bit per cell
+
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]>>>>
+>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>
+>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[
+-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>
+>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>
+>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]<<+[>>>>>[-],---------->+<[->>+<[-]<]>>[-<<+>>]<<++++++++++<<<<<<+>>
+>>>>[->>+<<<<<<<<[-]>>>>>>]>>[-<<+>>]<<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>[<
+<<<<<[-]>>>>>[-]>[-]]<[->+>+<<]>>[-<<+>>]<[<<<<+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>
+>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>
+>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]
+>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+
+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[-
+>+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<
+[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>
+]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<
++>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<
+<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<
+<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+
+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>
+>+<<<<<<+>]<[->+<]>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<
+<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<
+<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+
+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>
+>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<
+<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<
+<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<
+<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+
+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>
+>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<
+<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<
+<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<
+<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+
+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]>>>>>[->>+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<<<<<[->>>>>>>+<<<<
+<<<]>>>>>>>>+<[-<<<<<<<[->>>>>>>>>+>>+<<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>
+>>>>>]>[-<+>]<<]>[-]>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[
+-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>
+>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<
++>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<
+[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>
+]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]
+>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<
+<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>
+>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>
+[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->
+>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>
+>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-
+<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<
+<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>
+>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>
+>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>
+>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>
+>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<
+<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>
+>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<
+<<+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>
+>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+
+>>>>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+
+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>
+>>>>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<
+<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>
+>>+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<
+<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+
+<]>[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<
+<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>
+[-<+>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]
+<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<
++>]<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<
+[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]
+<<<<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->
+>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<
+<<<<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+
+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>>+<]>[-<+>]<<<<<<
+<[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<
+]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<+>>>>>>>>>+<]>[-<+>]<<<<<<<
+[-<<+>>]>[-<<<+>>>]<<<<+>[->>>[-<<<<<+>>>+>>]<<<<[->>>>+<<<<]<[->+<]>>]<
+[-]>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>
+>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>
+>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>
+>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-
+]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>
+>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>------------------------------------------------[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+[->+<]<<<<<[->>>>>>+<<<<<<]>>>>>>>+<[-<<<<<<[->>>>>>>>+>>>+<<<
+<<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>[-<+>]<<]>[-]>>>>[-<+>]>[-<<+>>]<<<+>
+[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>
+>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[-
+>>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>
+>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[
+-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>
+>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<
+<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>
+[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>
+>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+
+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>
+>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+
+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[
+-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<
+<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<
+<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>
+[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]
+<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>
+>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<
+<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>
+>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<
+<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>
+>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+
+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->
++<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<
+<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>
+[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>
+>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[-
+>>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>
+>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>[-<+>]>[
+-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>+<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>
+>]<[-]>>>>>>>>>>>>>>[-<<+>>]>[-<<<+>>>]<<<<+>[->>>[-<<<<<+>>>+>>]<<<<[->
+>>>+<<<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>]>[-
+]]<<<<<<]>>>>>+<<<[-<<+>>>>>[-]<<<]<<[->>+<<]>>>>>[<<[-]>>[-]]<<<[<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>[->>>>+<<<<<+>
+]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<
+[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[-
+>+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+
+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]
+>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>
+>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>
+>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>
+>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>
+>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>
+>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>
+>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++[<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<][-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->++<]<[->>+<<]>>[-<+<<--------
+-->>[-<<+<+>>>]<<<[->>>+<<<]>>>>>+<<<<[-<+>>>>>[-]<<<<]<[->+<]>+++++++++
++[-]>>>>[<<[-]<+>>>[-]]<]>>[-<++>]<<<<[->>>+<<<]>>>[->+>----------<[->+>
++<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<+
+>>[-]]>]>>>>[-<++>]<<<<<<<[->>>>>>+<<<<<<]>>>>>>[->+>----------<[->+>+<<
+]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<+
+>>>>>[-]]>]>>>>[-<++>]<<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>[->+>----
+------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++++++[-]<<
+<[>>[-]<<<<<<<<<<+>>>>>>>>[-]]>]>>>>[-<++>]<<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]>>>>>>>>>>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<
+<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<<<<<<+>>>>>>>>>>>[-]]>]>
+>>>[-<++>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>
+>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<+++
++++++++[-]<<<[>>[-]<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>[-]]>]>>>>[-<++>]<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++
+++++[-]<<<[>>[-]<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>[-]]>]>>>>[-<++>]<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>
+]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>[-]]>]<<<<<<<<<<<<<<<<<<<<<[-]<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+>+
+<<]>>[-<<+>>]<[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<[-<<
++>>>>>+<<<]>>>[-<<<+>>>]<<<<<+++++++++++++++++++++++++++++++++++++++++++
++++++.[-]>>>>[-]]<<[-]<<<[->>>>+<<<<<+>]<[->+<]>>>>>[<<[-]+>>[-]]<<[->>>
++<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<[->+<<+>]<[->+<]>>+++++++++++++++++
++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<[-]<<<[->>>>>>>+<<<<<<<<
++>]<[->+<]>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<
+<<<<<<[->>>>+<<<<<+>]<[->+<]>>>>>+++++++++++++++++++++++++++++++++++++++
++++++++++.[-]>>>>[-]]<<<<<<<<[-]<<<[->>>>>>>>>>+<<<<<<<<<<<+>]<[->+<]>>>
+>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<<<<[
+->>>>>>>+<<<<<<<<+>]<[->+<]>>>>>>>>+++++++++++++++++++++++++++++++++++++
++++++++++++.[-]>>>>[-]]<<<<<<<<<<<[-]<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<<+>
+]<[->+<]>>>>>>>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>
+>[<<<<<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>+++++++++++
++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<<<<<<<<<<[-]<<<[->
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>>>>[<<[-]+>>[-]
+]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
++<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++
++++++++++++++++.[-]>>>>[-]]<<<<<<<<<<<<<<<<<[-]<<<[->>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>>>>>>>[<<[-]+>>[-]]<<[->>>+<
+<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>>>>+++++++++++++++++++++++++++++++
++++++++++++++++++.[-]>>>>[-]]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<+>]<[-
+>+<]>>>>>>>>>>>>>>>>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]
+>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
++>]<[->+<]>>>>>>>>>>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++
+++++++.[-]>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++.----------------------------------------------------------<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]+>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>
+>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>
+>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[
+-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>
+>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>
+>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>
+>>>>>>>[-]+>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>
+>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[
+-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>
+>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>
+>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>+<<<<<<<<[->>>>>>>>+>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>]<<<<<<<<<<<<<[->>>->>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<[->>+<<]>[->+<]>>+<[-<[->>>+>+<<<<]>>[
+-<<+>>]>[-<+>]<<]>[-]<<[-]>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>
+>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<
+<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>
+>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>
+>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<
+<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+
+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>
+>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>
+>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>
+[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<
+]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->
+>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-
+<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]
+>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-
+<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+
+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+
+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[-
+>>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+
+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<
++>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>
+>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>
+>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<
+<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]
+<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<
+]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[
+-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>
+>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>
+>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<
+<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<
+<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<
+]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>
+>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>
+>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>
++<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[
+->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<
+[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[
+-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>
+[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<
+<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-
+<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<
+[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>
+>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]
+<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-
+]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<
+<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+
+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<
+<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<
+<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>+>>>>[-<<<<+>>>>>>>>>>+<<<<<<]>>>>>>[-<<<
+<<<+>>>>>>]<[-<<<<<<<<<->>>>>>>>>>+<]>[-<+>]<<<<<<<[-<<<+>>>]<<[-<+>]<<+
+>[->[-<<<+>>>>+<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>[->>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>
+>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[
+-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>
+>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>
+>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>
+>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-
+]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>
+>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>
+>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>
+>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>
+[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>
+>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>
+>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>
+>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]
+>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>+>
+>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>
+>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>
+>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>
+>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>
+>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]
+>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+
+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[-
+>+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<
+[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>
+]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<
++>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<
+<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>>+<<
+<<<<+>]<[->+<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++
+++++++++[<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[
+->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<
+<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>
+>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>][-]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]>>>>>>>>[->>>+<<<<<<<
++>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<
+]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>
+>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[-
+>>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>
+>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>
+>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>
+>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<
+<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>
+>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>
+>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]
+<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>
+>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<
+<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<
+<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[
+->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<
+<[->>>>+<<<<]>>>>>>>>>>>>>>>>[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>
+>>>>>>>>[->>>+<<<<+>]<[->+<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>+<<<<<<<[->>>>>>>->>>+<<<<<<<<<<]>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<
+<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<
++>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<
+<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>
+>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<
+<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]
+<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<
+]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<
+[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>
+>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[-
+>>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>
+[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>
++<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-
+<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<
+<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<
+<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]
+>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+
+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>
+>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>
+>]>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>
+>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]
+>[-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>
+>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[
+-<+>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>
+[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<
++>]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[-
+>+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>
+]<<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+
+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<
+<]>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]
+<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]
+>[-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[
+->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[
+-]>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->
+>+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]
+>>>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+
+<<]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>
+>>>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<
+]>>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>
+>>>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>
+>>+<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>
+>>>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>
++<[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>
+>>>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<
+[-<<[->>>>+>>>>>>>>>+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>
+>+<<<<<<<[->>>>>>>-<<<<<<<<<+>>]<<[->>+<<]>>>>>>>>[->+<]<[->>+<<]>>>+<[-
+<<[->>>>+>>>>>>>+<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>+>[-<+>]>
+[-<<+>>]>>+<<<<[->>[->>>+<<+<]>>[-<<+>>]>[-<+>]<<<<<]>>>>[-]<[-]>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>
+>>>>>>>[>[-]<[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<[->>>>>>>>
+>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<
+<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<
+<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<
+<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>
+>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<
+<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<
+<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<
+<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>
+>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<
+<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>+>]<[->+<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[<<<<[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]
+>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>
+[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>
+>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>
+>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>
+>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>
+>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>
+>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[
+-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>
+>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>
+>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>
+>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<
+<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>[-<<<+>>>
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]>>>>>>>
+>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>
+>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>
+>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[
+-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>
+>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>
+>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>
++>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>
+>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>
+>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>
+>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+
+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>
+>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>
++>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>
+>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>
+>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>
+>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+
+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>
+>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>
++>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>
+>[-<<<+>>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>
+>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>
+>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>[->>+>+<<<]>>>[-<<<+>>>]<[->>>>>>>>>+<<<
+<<<<<<]>>>>>>>>>>[-<+>>+<]>[-<+>]>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<[->>+>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<]>>[-<<+>>
+]<<[-]+>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>+>+<<<<]>>
+>>[-<<<<+>>>>]>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<
++>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>
++<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>
+>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>
+>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>
+>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->
+>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>
+]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<
+<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[-
+>>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>
+>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>
+>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<
+<]>>>>>>>>>>>>>>[->>>+<<<<<+>>]<<[->>+<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>
+>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>
+>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>
+>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>
+>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-
+]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>
+>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-
+<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>
+>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>
+>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>
+>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>
+>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>[-<<+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]+>>>>>>>>>>>>[-]>>>>>>>>>>>>[-
+]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>
+>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>
+>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>
+>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>
+>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>+<<<<<<<<[->>>>>>>>+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>->>>>>>>>>>+<<<
+<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<[->>+<
+<]>[->+<]>>+<[-<[->>>+>+<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>+>>>[-<<<+<<
+<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]
+<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>
++<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<
+<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>
+[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>
+>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<
+->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>
+>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<
+<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[
+->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>
+>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<
+<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>
+>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>
+>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<
+<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+
+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>
+>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>
+>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>
+[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<
+]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->
+>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-
+<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]
+>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-
+<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+
+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+
+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[-
+>>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+
+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<
++>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>
+>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<
+<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>
+>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<
+<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]
+<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<
+]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[
+-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>
+>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>
+>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<
+<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<
+<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<
+]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>
+>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>
+>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>
++<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[
+->>>>>>+<<<<<<]>>>>>>>>>>>[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<
+[-<+>]<<+>[->[-<<<+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[
+-]>>[-]>>>>>>>>>>>+>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>
+[-<<<<<<<<->>>>>>>>>+<]>[-<+>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>>>>+>>>>[-<<
+<<+>>>>>>>>>>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[-<<<<<<<<<->>>>>>>>>>+<]>[-
+<+>]<<<<<<<[-<<<+>>>]<<[-<+>]<<+>[->[-<<<+>>>>+<]<<[->>+<<]<[->+<]>>]<[-
+]>>[-]>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-
+]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>
+>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>
+>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>
+>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>
+>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>>>>[-]>>>>>>>>>[-]>>
+>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>+<<<<<[->>>>>+>>>+<<<
+<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<<[->>>>>>->>>+<<<<<<<<<]>>>>>>
+>>>[-<<<<<<<<<+>>>>>>>>>]<<<<<[->>+<<]>[->+<]>>+<[-<[->>>+>>+<<<<<]>>[-<
+<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>
++<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+
+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<
+<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<
+<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<
++>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>
+>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-
+<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+
+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>
+>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[
+-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>
+-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>
+>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<
++>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<
+<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>
+>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<
+<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<
+<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<
+<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>
+>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>
+>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<
+<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<
++>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>
++<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+
+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<
+<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<
+<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<
++>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>
+>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-
+<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+
+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>
+>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[
+-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>
+-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>
+>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<
++>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<
+<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>
+>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<
+<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<
+<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<
+<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>
+>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>
+>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<
+<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<
++>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>
++<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+
+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<
+<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<
+<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<
++>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>
+>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-
+<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<[-]>>>>>>>>>>>>>+<<<<[->>>>+
+<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>[->>>>>-<<<<<<<<+>>>]<<<[->>>+<<<]>[->>
+>>>>>+<<<<<<<]>>>>>>[->+<]>>+<[-<[->>>+>>>+<<<<<<]>>[-<<+>>]>[-<+>]<<]>[
+-]<<[-]>>>>+>>>>>[-<<<<<+>>>>>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<[-<<<<->>>>
+>>>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<<<<[-<<+>>]<[-<+>]<<+>[->[-<<<+>>>>>>
+>>>>+<<<<<<<]<<[->>+<<]<[->+<]>>]<[-]>>[-]>>>>>>>[->>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[
+-]<<<<<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]>>>>>>>[->>>>+<<<<<+>]<
+[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[-
+>+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+
+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]
+>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>
+>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>
+>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>
+>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>
+>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>
+>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>
+>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[
+->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>[->>>>+<<<<<+>]<[->+<]>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-]>>[-]]<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<]<<<<[->>>
+>>+<<<<<]>>>>>>+<[-<<<<<[->>>>>>>+>>>+<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>
+[-<+>]<<]>[-]>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<
+<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<
++>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>
+>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+
+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+
+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>
+>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>
+>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<
+<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<
+<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[-
+>>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<
+<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<
+<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>
+>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>
+>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<
+<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>
+>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>
+>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>
+>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[
+->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>
+>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[
+-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->
+>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<
+<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<
+<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>
+>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<
+<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>
+>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<
+<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>
++>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<
+[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<
+<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<
++>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>
+>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+
+>[->>>[->>>>+>>>>>>+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>
+>>]<<<<<<<]<[-]>>>>>>>>>>>>>>[-<+>]>>[-<<<+>>>]<<<<+>[->>>[->>>>+>>>>>>+
+<<<<<<<<<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>>>>
+>>>>>>>>>[-<<+>>]>>[-<<<<+>>>>]>>>>+<<<<<<<<[->>>>[-<<<<<+>>+>>>]>>>>[-<
+<<<+>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>]>>>>>>>>[-]<<<<<<<[-]>>>>>>>>>
+>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+
+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]
+<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>
+>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<
+<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>
+>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[
+-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>
+>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<
+<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>
+>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>
++<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>
+]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>
+>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>
+>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>
+[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>
+>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<
+<<<<<<<<<<]>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>
+>>>>>>>>>[->+>+<<]>>[-<<+>>]<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>[->+
+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<]>[-<+>]<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-[<<<<++++++++++++
+++++++++++++++++++++.--------------------------------<[-]+++++++++++++++
++++++++++[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<][-]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<
+<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>
+>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<
+[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->++<]<
+[->>+<<]>>[-<+<<---------->>[-<<+<+>>>]<<<[->>>+<<<]>>>>>+<<<<[-<+>>>>>[
+-]<<<<]<[->+<]>++++++++++[-]>>>>[<<[-]<+>>>[-]]<]>>[-<++>]<<<<[->>>+<<<]
+>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<+++
++++++++[-]<<<[>>[-]<<<<+>>[-]]>]>>>>[-<++>]<<<<<<<[->>>>>>+<<<<<<]>>>>>>
+[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++
+++++[-]<<<[>>[-]<<<<<<<+>>>>>[-]]>]>>>>[-<++>]<<<<<<<<<<[->>>>>>>>>+<<<<
+<<<<<]>>>>>>>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>
+]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<<<+>>>>>>>>[-]]>]>>>>[-<++>]<<<<<
+<<<<<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>[->+>----------<[->+>+<<
+]>>[-<<+>>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<
+<<<<<+>>>>>>>>>>>[-]]>]>>>>[-<++>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[-
+>+<<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>[-]]>]>>>>[-<++>]<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>[->+>----------<[->+>+<<]>>[-<<+>>]<<<<+>>>[->+<
+<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>[-]]>]>>>>[-<++>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[->+>----------<[->+>+<<]>>[-<<+>
+>]<<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++++++[-]<<<[>>[-]<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>[-]]>]<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<-]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<[<<[-]+>>[-]]<<[->>>+<<<
+<<<+>>>]<<<[->>>+<<<]>>>>>>[<<[-<<+>>>>>+<<<]>>>[-<<<+>>>]<<<<<+++++++++
++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<[-]<<<[->>>>+<<<<<+
+>]<[->+<]>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<[
+->+<<+>]<[->+<]>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>
+>[-]]<<<<<[-]<<<[->>>>>>>+<<<<<<<<+>]<[->+<]>>>>>>>>[<<[-]+>>[-]]<<[->>>
++<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<[->>>>+<<<<<+>]<[->+<]>>>>>+++++
++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<<<<[-]<<<[->
+>>>>>>>>>+<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>
+>]<<<[->>>+<<<]>>>>>>[<<<<<<<<<<<[->>>>>>>+<<<<<<<<+>]<[->+<]>>>>>>>>+++
++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<<<<<<<[-]<
+<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>[<<[-]+>>[-]]<<[
+->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<
+<<+>]<[->+<]>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.
+[-]>>>>[-]]<<<<<<<<<<<<<<[-]<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<+>]<[
+->+<]>>>>>>>>>>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>
+>[<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>
+>++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<<<<<<<
+<<<<<<[-]<<<[->>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>
+>>>>>>>>>>>>[<<[-]+>>[-]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<
+<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>
+>>>++++++++++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>>>>>>>>>>[<<[-]+>>[-
+]]<<[->>>+<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<+>]<[->+<]>>>>>>>>>>>>>>>>>>>>++++++++
+++++++++++++++++++++++++++++++++++++++++.[-]>>>>[-]]<<<<<<<<<<<<<<<<<<<<
+<<<[-]>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]<]<<<++++++++
+++.---------->[-]]>]
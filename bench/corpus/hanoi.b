@@ -0,0 +1,207 @@
+Towers of Hanoi for 20 disks from peg A to peg C
+Moves come from a binary move counter: the disk to move is the bit
+that turns on and each disk cycles round the pegs in a fixed direction
+
+>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>
++>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>
+>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+[>[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]+<[<<<<[-]>>>>>>>>>[-<<<+>>+>
+]<[->+<]+<<[>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<
+[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>
+>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>
+>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>
+>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>
+[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]
+>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>
+>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>
+>>>[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>
+[-<<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<
+<<<<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<
+<<<<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<
+<<<<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<
+<+>>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>
+>>>>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>
+>>>>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>
+>>>+>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>
++>]<[->+<]+<<<<<<<<<<[>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++++++
+++++++++++++++++++++++++++++++++++.--.----------------.-----------------
+--------------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<
++>>>]<.[-]<<<<[->>>>+<<<<]>[-<+>]>[-<+>]>>[-<<+>>]<+++++++++++++++++++++
++++++++++++.+++++++++++++.+++++++++++++++++.----------------------------
+--.-------------------------------->++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>
+[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<
+<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++++++++++++++++++++++++++++++++
++++++++.++++++++.-------------------------.-----------------------------
+--->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<
+[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<
+[->>+<<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<++++++++++++++++++++++++++++++++.
++++++++++++++.+++++++++++++++++.------------------------------.---------
+----------------------->++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]
+>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]
+]>>>>>>>>>>[>+>>>>+++++++++++++++++++++++++++++++++++++++++++++++++.++++
++++.------------------------.-------------------------------->++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+
+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<<]
+>[-<+>]>[-<+>]>>[-<<+>>]<++++++++++++++++++++++++++++++++.+++++++++++++.
++++++++++++++++++.------------------------------.-----------------------
+--------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<
+.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+
+>>>>+++++++++++++++++++++++++++++++++++++++++++++++++.++++++.-----------
+------------.-------------------------------->++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+
+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<[->>+<<]<[->+<]<[->+<]>>>>[-<<
+<<+>>>>]<++++++++++++++++++++++++++++++++.+++++++++++++.++++++++++++++++
++.------------------------------.-------------------------------->++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<
+<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.
+----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++
++++++++++++++++++++++++++++++++++++++.+++++.----------------------.-----
+--------------------------->++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+
+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<<]>[-<+>]>[-<+>]>>[-<<+>>]<+++++++++
++++++++++++++++++++++++.+++++++++++++.+++++++++++++++++.----------------
+--------------.-------------------------------->++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>
+>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<
+<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++++++++++++++++++++
++++++++++++++++++++.++++.---------------------.-------------------------
+------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[
+-]<<[->>+<<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<+++++++++++++++++++++++++++++
++++.+++++++++++++.+++++++++++++++++.------------------------------.-----
+--------------------------->++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+
+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<
+<[-]]>>>>>>>>>>[>+>>>>+++++++++++++++++++++++++++++++++++++++++++++++++.
++++.--------------------.-------------------------------->++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>
+]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<<]>[-<
++>]>[-<+>]>>[-<<+>>]<++++++++++++++++++++++++++++++++.+++++++++++++.++++
++++++++++++++.------------------------------.---------------------------
+----->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<
+<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]
+<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>
++++++++++++++++++++++++++++++++++++++++++++++++++.++.-------------------
+.-------------------------------->++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[-
+>>++>+<<<]>>>[-<<<+>>>]<.[-]<<[->>+<<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<+++
++++++++++++++++++++++++++++++.+++++++++++++.+++++++++++++++++.----------
+--------------------.-------------------------------->++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<
+<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<
+<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++++++++++++++
++++++++++++++++++++++++++.+.------------------.-------------------------
+------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[
+-]<<<<[->>>>+<<<<]>[-<+>]>[-<+>]>>[-<<+>>]<+++++++++++++++++++++++++++++
++++.+++++++++++++.+++++++++++++++++.------------------------------.-----
+--------------------------->++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+
+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<
+<[-]]>>>>>>>>>>[>+>>>>+++++++++++++++++++++++++++++++++++++++++++++++++.
+.-----------------.-------------------------------->++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[
+->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<[->>+<<]<[->+<]<[->+<]>>
+>>[-<<<<+>>>>]<++++++++++++++++++++++++++++++++.+++++++++++++.++++++++++
++++++++.------------------------------.-------------------------------->
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>
+>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<+++++
++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++
++++++++++++++++++++++++++++++++++++++++++++.-.----------------.---------
+----------------------->++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]
+>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<<]>[-<+>]>[-<+>]>>[-<<+>>]<+++++++++++++
++++++++++++++++++++.+++++++++++++.+++++++++++++++++.--------------------
+----------.-------------------------------->++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<
+<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<
+<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++.-------------------------.----------------------
+---------->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]
+<.[-]<<[->>+<<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<++++++++++++++++++++++++++
+++++++.+++++++++++++.+++++++++++++++++.------------------------------.--
+------------------------------>+++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>+
++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<
+<<<<[-]]>>>>>>>>>>[>+>>>>+++++++++++++++++++++++++++++++++++++++++++++++
++++++++++.------------------------.-------------------------------->++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<
+<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>
++<<<<]>[-<+>]>[-<+>]>>[-<<+>>]<++++++++++++++++++++++++++++++++.++++++++
++++++.+++++++++++++++++.------------------------------.-----------------
+--------------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<
++>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>
+>>>[>+>>>>+++++++++++++++++++++++++++++++++++++++++++++++++++++++.------
+-----------------.-------------------------------->+++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[-
+>>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<[->>+<<]<[->+<]<[->+<]>>>
+>[-<<<<+>>>>]<++++++++++++++++++++++++++++++++.+++++++++++++.+++++++++++
+++++++.------------------------------.-------------------------------->+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>
++<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++
+++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>+++++++
++++++++++++++++++++++++++++++++++++++++++++++++.----------------------.-
+------------------------------->++++++++++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>
+++>+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<<]>[-<+>]>[-<+>]>>[-<<+>>]<+++++
++++++++++++++++++++++++++++.+++++++++++++.+++++++++++++++++.------------
+------------------.-------------------------------->++++++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[
+->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<
+<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>>>++++++++++++++++++++++++++
++++++++++++++++++++++++++++.---------------------.----------------------
+---------->+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]
+<.[-]<<[->>+<<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<++++++++++++++++++++++++++
+++++++.+++++++++++++.+++++++++++++++++.------------------------------.--
+------------------------------>+++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>+
++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<
+<<<<[-]]>>>>>>>>>>[>+>>>>+++++++++++++++++++++++++++++++++++++++++++++++
++++++.--------------------.-------------------------------->++++++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>
+>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<<]>[
+-<+>]>[-<+>]>>[-<<+>>]<++++++++++++++++++++++++++++++++.+++++++++++++.++
++++++++++++++++.------------------------------.-------------------------
+------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[
+-]<++++++++++.----------<<<<<-]<<<<<<<<<[-]<<<<<<<<<<[-]]>>>>>>>>>>[>+>>
+>>+++++++++++++++++++++++++++++++++++++++++++++++++++.------------------
+-.-------------------------------->+++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[
+->>++>+<<<]>>>[-<<<+>>>]<.[-]<<[->>+<<]<[->+<]<[->+<]>>>>[-<<<<+>>>>]<++
+++++++++++++++++++++++++++++++.+++++++++++++.+++++++++++++++++.---------
+---------------------.-------------------------------->+++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<<+>>>>]<<
+<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<++++++++++.----------<
+<<<<-]<<<<<<<<<[-]<<[-]]>>[>+>>>>+++++++++++++++++++++++++++++++++++++++
++++++++++++.------------------.-------------------------------->++++++++
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<[->>>+<<<<<<
+<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>]<.[-]<<<<[->>>>+<<<
+<]>[-<+>]>[-<+>]>>[-<<+>>]<++++++++++++++++++++++++++++++++.++++++++++++
++.+++++++++++++++++.------------------------------.---------------------
+----------->++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++<<<[->>>+<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>[->>++>+<<<]>>>[-<<<+>>>
+]<.[-]<++++++++++.----------<<<<<-]<<<[-]<[-]]>[<<<<<+>>>>>>++++++++++++
++++++++++++++++++++++++++++++++++++++.-----------------.----------------
+---------------->+++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++<<<<<[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<[->>>>++>+<<<
+<<]>>>>>[-<<<<<+>>>>>]<.[-]<<<<[->>>>+<<<<]<[->+<]<[->+<]>>>>>>[-<<<<<<+
+>>>>>>]<++++++++++++++++++++++++++++++++.+++++++++++++.+++++++++++++++++
+.------------------------------.-------------------------------->+++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++<<<<<[->>>>>+>
++<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<[->>>>++>+<<<<<]>>>>>[-<<<<<+>>>>>]<.
+[-]<++++++++++.----------<-]<<<<<<]
@@ -0,0 +1,42 @@
+Brainfuck interpreter: reads a program up to an exclamation mark then
+runs it on the rest of the input; 96 frames of 10 cells hold the program
+then its tape with markers for the instruction pointer and tape head
+
+>>+>+>++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++[->>>>>>>>>>+<<<<<<<<<<]>>>>>>>>>>[-[->>>>
+>>>>>>+<<<<<<<<<<]<<<+>+>+>>>>>>>>>>>]<<<<<<<<<<<<<[<<<<<<<<<<]>>>>>>>>>
+>>[>>[-],[->+>+<<]>>[-<<+>>]+<<[->>>+<[-]<<]>>>[-<<<+>>>]<<-------------
+-------------------->+<[->>+<[-]<]>>[-<<+>>]<<---------->>+<<[->>>+<[-]<
+<]>>>[-<<<+>>>]<[<<<<<<<+>>>>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[
+<<<<<<<++>>>>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<<<<<+++>>>>>>
+>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<<<<<++++>>>>>>>[-]]<<-------
+------->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<<<<<+++++>>>>>>>[-]]<<-->>+<<
+[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<<<<<++++++>>>>>>>[-]]<<------------------
+----------->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<<<<<+++++++>>>>>>>[-]]<<-
+->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<<<<<++++++++>>>>>>>[-]]<<++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++>[<<<<[-]>>>>[-]]<[-]<[-]<<<<[>>>>>>>>>>]>>]+<[<<<<<<<<<<]>>>
+>>>>>>>>-<<[>>>>>>>>>>]>>>>>>>>>>>>>-<[<<<<<<<<<<]<<[[->>>>+>>+<<<<<<]>>
+>>>>[-<<<<<<+>>>>>>]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<[>>>>>>>>>>]<
+<<+>>[<<<<<<<<<<]>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<[>>>>>>>
+>>>]<<<[-],>>[<<<<<<<<<<]>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<
+[>>>>>>>>>>]<<<->>[<<<<<<<<<<]>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]
+<[<<<[>>>>>>>>>>]<<<.>>[<<<<<<<<<<]>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<
++>>>]<[<<<[>>>>>>>>>>]+<<<<<<<<<<->>>>>>>>>[<<<<<<<<<<]>>>>[-]]<<->>+<<[
+->>>+<[-]<<]>>>[-<<<+>>>]<[<<<[>>>>>>>>>>]+>>>>>>>>>>-<<<<<<<<<<<[<<<<<<
+<<<<]>>>>[-]]<<->>+<<[->>>+<[-]<<]>>>[-<<<+>>>]<[<<<[>>>>>>>>>>]>>>>+<<<
+<<<<[->>>>>>>>+<[-]<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<[<<<<<[<<<<<<<<<
+<]>>>+<<[>>>>>>>>>>]>>>>[-]]<<<<<[<<<<<<<<<<]>>>>[-]]<<->>+<<[->>>+<[-]<
+<]>>>[-<<<+>>>]<[<<<[>>>>>>>>>>]<<<[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<
+<<+>>>>>>>>]<[<<<<<[<<<<<<<<<<]>>>++<<[>>>>>>>>>>]>>>>[-]]<<<<<[<<<<<<<<
+<<]>>>>[-]]<<++++++++[-]>[->>>+>+<<<<]>>>>[-<<<<+>>>>]<-<<+>>[->+<<<[-]>
+>]>[-<+>]<+[-]<<<[->>>+>+<<<<]>>>>[-<<<<+>>>>]<--<+>[->+<<[-]>]>[-<+>]<+
++[-]<<<[-]>[[-]<<+[[->>>>>>>>>>+<<<<<<<<<<]<<+>>>>>>>>>>-<<[->>>>>>>>+<<
+<+<<<<<]>>>>>[-<<<<<+>>>>>]>>>------->+<[-<<<+>>>>[-]<]<<<[->>>+<<<]>>>+
+++++++[-]>[<<<<<+>>>>>[-]]<<<<<<<<<[->>>>>>>>+<<<+<<<<<]>>>>>[-<<<<<+>>>
+>>]>>>-------->+<[-<<<+>>>>[-]<]<<<[->>>+<<<]>>>++++++++[-]>[<<<<<->>>>>
+[-]]<<<<<]>>]>[[-]<<<+[[-<<<<<<<<<<+>>>>>>>>>>]<<+<<<<<<<<<<-<<[->>>>>>>
+>+>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]<-------<<<+>>>[->+<<<<[-]>
+>>]>[-<+>]<+++++++[-]<<<[<->[-]]<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<
+<<<<<<<<+>>>>>>>>>]<--------<<<+>>>[->+<<<<[-]>>>]>[-<+>]<++++++++[-]<<<
+[<+>[-]]<]>>>]<<<<<+>>>>>>>>>>-<<]
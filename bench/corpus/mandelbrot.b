@@ -0,0 +1,1066 @@
+Mandelbrot set in ASCII over 96 columns and 36 rows with up to 48 iterations
+Numbers are 16 bit two's complement fixed point with 8 fraction bits kept one bit per cell
+so the program runs the same on any cell width
+
+>[-]+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>
+>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>
+>>>>>>>>>[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>[-]++++++++++++++++++++++++++++++++++++[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>
+>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>
+>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>
+>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>[-]+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++++[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++
+++++++++++++++++>>>+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>>[-<<
+<<<<<<<+>>>>>>>>>]>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>
+>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[
+->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<
+<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]
+<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]
+>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>
+>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>
+>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<
+<<+>>>]<<<[->>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->
+>>+<<<]>>>>>>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>
+>>>>>>>>>>>>>[->>>>>>>>+<<<<<<+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->>>>>>>>+<<<
+<<<+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->>>>>>>>+<<<<<<+<<]>>[-<<+>>]>>>>>>[->>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<<]>>[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>
+[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>
+>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>
+>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]
+>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>
+>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>
+>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>>+<<[->
+>-<<]>>[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<]<[->>+<<]>>>+<[-<<[->>>>+
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>
+>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<
++>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<
+[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-
+<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]
+>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>
+[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<
+<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>
+>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]
+>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>
+>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<
++>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<
+[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-
+<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-
+]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>>>>
+>>>>>>>>[-<<<<<<+>>>>>>]<<[-<<<<+>>>>]>>>>+<<<<<<<<[->>>>[-<<<<<+>>>>>>>
+>+<<<]>>>>[-<<<<+>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>]>>>>>>>>[-]<[-]<<
+[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>
+>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>
+>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>
+>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<
+<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>
+>>>>]>>>>>>>>>>>>>>>>[-<<<<<<+>>>>>>]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>+>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>>>>>>>>[->>>>>>>+<<<<<
+<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>
+>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[-
+>>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[->>>>+<<<<
+]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>
+>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>
+>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>
+>>>+<<<<<<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<
+<<<<<<+>>>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>
+>>]<<<<[->>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[-
+>>>>+<<<<]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<<<<<<+>>>>]<<<<[->>>>+<<<<
+]>>>>>>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>>[->>>>>>>+
+<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>>[->>>>>>>+<<<<<<+<]>[-<+>]>>>>>>[->>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<]>[-<+>]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+<]>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>
+]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>
+>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[
+->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+
+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>
+>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<
+[->-<]>[-<+>]>>>>>>>>>>>>>>>>+<[->-<]>[-<+>]>>>>>>>>>>>>>>>>>+<<[->>-<<]
+>>[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+
+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]
+>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+
+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<
+<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<
+[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>
+>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>
+>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>
+>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-
+<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+
+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]
+>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+
+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<
+<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>
+>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>>>>>>>>>
+>>>[-<<<<<<+>>>>>>]<<[-<<<<+>>>>]>>>>+<<<<<<<<[->>>>[-<<<<<+>>>>>>>>+<<<
+]>>>>[-<<<<+>>>>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]>]>>>>>>>>[-]<[-]<<[-]]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>
+>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>
+[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>
+>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<
+<+>>>>>]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>+>>>>+<<<<<<]>>>>>>[-<<<<<
+<+>>>>>>]>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>
+>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<
+<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<
+<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<
+<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>
+>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>
+[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+
+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[-
+>>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>
+>>>>>>>>>>>>>>>>>>>>[->>+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>>>+<<<<<<<<<]>>>>>>>>>[-<<<<<<<<<+
+>>>>>>>>>]<<<<[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[->>>>>>>+>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<+>]<<]>[-]>>>>>>>>>[
+->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<
+]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+
+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<
+<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<
+<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<
+<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]
+>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>
+>>>>>[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>
+>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<
++>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]<<<<[->>>>>+<<<<<]>>
+>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]
+>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>
+>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<
+<<]>>>>>>>>>>>>[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<
+<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<
+<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]<<<<[->>>>
+>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<
+<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>
+>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>
+]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[-
+>>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]
+<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<
+<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<
+<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<
+<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<
+<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>
+>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>
+>>>>[->+<]<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>
+>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>]>[-]>>>>>>>>>[->>>>>>+<<<<<<<<<<<<<+
+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>[->+<]<<<<[->>>>>+<<<<<]>>>
+>>>+<[-<<<<<[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<]>
+>>>>>[-<<<<<<+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>
+>>>>]>[-]>>>>>>>>>[->>>>>>>+<<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>+<<<<
+<<<]>>>>>>>>>>>>[->>+<<]<<<<[->>>>>>+<<<<<<]<<<<<<<+>>>>>>>>>>>>>[-<<<<<
+<[->>>>>>>+<<+<<<<<]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>]<]<<<<<<<<<<<<<[-]>>>>>>>>>>>>[-][-]+++[<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>+>+<<<<<<<]>>>>>>>[-<<
+<<<<<+>>>>>>>]>>>>>>>>>[->>>>>>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>
+>>>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>
+>>>>>>>>>>>>>[->>>>>>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>
+>>>>>>>>[->>>>>>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>
+>>>[->>>>>>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[-
+>>>>>>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>>>>
+>+<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>>>>>+<<<
+<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<<<
+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<<<<<<+>
+>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<<<<<<+>>>>>]
+<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<<<<<<+>>>>>]<<<<<
+[->>>>>+<<<<<]>>>>>>>>>>>>>>[-]+++++++++++++[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<]>[-<+>]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<<<<<<
+]>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]>>+<[-<[->>>+>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[-
+>+<]>>+<[-<[->>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[->>+<<]>[->+<]>>+<[-<[->>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+]>>[-<<+>>]>[-<+>]<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]>>+<[-<[->>>+>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+>>+<<]>[->+<]>>+<[-<[->>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<]>>[-<<+>>]>[-<+>]
+<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<
+<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]>>+<[-<[->>>+>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]>>+<[
+-<[->>>+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<]>>[-<<+>>]>[-<+>]<<]>[-]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>
+>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>>>>+<<<<<]<<<[->>>>>>>>+<<<<<<<<]>>
+>>>>>>>+<[-<<<<<<<<[->>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<]>>>>>>>>>[-<<<<<<<
+<<+>>>>>>>>>]>[-<+>]<<]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]<<+>>
+>[-<[->>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<[->>+<<]>>>>[-<<<<+>>>>]<]<<<[-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>[->>+<<]>[->+<]<<+>>>[-<[->>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<]<<[->>+<<]>>>>[-<<<<+>>>>]<]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]<<+>>>[
+-<[->>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<[->>+<<]>>>>[-<<<<+>>>>]<]<<<[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[->>+<<]>[->+<]<<+>>>[-<[->>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]
+<<[->>+<<]>>>>[-<<<<+>>>>]<]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[->>+<<]>[->+<]<<+>>>[-<
+[->>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<[->>+<<]>>>>[-<<<<+>>>>]<]<<<[-]>>>
+>>>>>>>>>>>>>>[-<<+>>]>[-<<<+>>>]<<<<+>[->>>[-<<<<<+>>>+>>]<<<<[->>>>+<<
+<<]<[->+<]>>]<[-]>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<+>>>]>>>>>>
+>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]
+>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<
+<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>
+>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>
+>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-<<<+>>>]>>
+>>>>>>>>>>>>>>[-<<<+>>>]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>
+>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>
+>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>
+>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<
+]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>
+>>>>>>>>>[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>[->>>>>>+<<<<<<]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>
+>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-
+<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>
+>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>
+>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>
+>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>
+>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[
+-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>
+>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[
+-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>
+>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<
+<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>
+>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>>>]>>>>>>>>>>>>>>>>[-<<<<+>>
+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>+<<<]>>>>>>>>
+>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>
+>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+
+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>
+[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>
+>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>>>>>>>>>>>>>[->>>+<<<]>>>>
+>>>>>>>>>>>>[->>>+<<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>
+]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>
+>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>
+>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[
+-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>
+>>>>>>>>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>]
+>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>
+>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>
+>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-
+<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>
+>>>>>>>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<+>]>>>>>>>>>>>>>>>>[-<+>]>
+>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>
+>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>
+>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<
++>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>>>>>>>>>>>>>>[-<+>]>>>
+>>>>>>>>>>>>>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->+>+<<]>>[-<<+>>]>>>>>>>
+>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>
+>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>
++<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>
+[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>
+>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>
+>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>
+>>>>[->+>+<<]>>[-<<+>>]>>>>>>>>>>>>>>[->+>+<<]>>[-<<+>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[->>>>>+>>>+<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<[->+<]<
+[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-
+<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<
+<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>
+>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[
+->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>
+>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>
+>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<
+<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->
+>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<
+<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>
+>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[
+-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>
+>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<
+<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>
+>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<
+[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-
+<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<
+<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>
+>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[
+->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>
+>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>>
+>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<
+<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<<<<<<<+>>>>>>>>]<<<<<<<<[->
+>>>>>>>+<<<<<<<<]>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>[->>>>>+<<<<<<<
++>>]<<[->>+<<]>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>
+>>>>>>[->>>>>+<<<<<<<+>>]<<[->>+<<]>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<
+<<<<<]>>>>>>]>[-]>>>>>>>>>>[->>>>>>+<<<<<<<<+>>]<<[->>+<<]>>>>>>[->>+<<]
+<[->>>+<<<]<<<<+>>>>>>>[-<<<[->>>>+<<+<<]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<
+<<<+>>>>>>>>]<]<<<<<<<[-]>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<[->+<]<[->>+
+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<
+<]>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<
+]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]
+>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>
+>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[
+-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>
++<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]
+>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<
+[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>
+>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<[->>+<<]>>>+<[-<<[
+->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>
+>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[->
+>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]>[-<+>]<<]>[-]>>>>>>>>>
+>>>>>>+<[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>>>>>>>>>>>>+
+<[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]
+>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>>>>>>>>>>>>>+<<[->>
++<<]<[->>>+<<<]<<<<+>>>>>>>[-<<<[->>>>+<<+<<]<<<<[->>>>+<<<<]>>>>>>>>[-<
+<<<<<<<+>>>>>>>>]<]<<<<<<<[-]>>>>>>[->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[
+-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>
+>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>
+>>>>>>>[-]>>>>>>>>>>>>>>>>[-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>[<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<
+<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-
+]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<
+<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>
+[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->
++<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[
+-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>
+>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>
+>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>-
+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>
+>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<
+<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-
+]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<
+<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>
+[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->
++<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[
+-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>
+>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>->>>+<<<<<]>>
+>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<[->>-
+>>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>
+>>>>+<<[->>->>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<
+<<[->>>>>+>>>>>>>>>+<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>
+>>>>>>>+<[->->>+<<<]>>>[-<<<+>>>]<<<<<<[->>>>+<<<<]>>[->>+<<]<<<+>>>>>[-
+<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<<<]<<<[->>>+<<<]>>>>>>[-<<<<<<+>>>>>>]<]
+<<<<<[-]>>>>>>>>>>>>>>>>>>>>>+<[->->>+<<<]>>>[-<<<+>>>]<<<<<<[->>>>+<<<<
+]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<<<]<<<[->>>+<<<]>>
+>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>+<<[->>->>+<<<<]>>>>
+[-<<<<+>>>>]<<<<<<<[->>>>>+<<<<<]>>[->>>+<<<]<<<<+>>>>>>>[-<<<[->>>>+<<<
+<<<<+>>>]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<]<<<<<<<[-]>[-]<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>+<<<<[->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[
+->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>
+>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[
+->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[
+-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>
+[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[
+->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>
+>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[
+->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[
+-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>
+[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[
+->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>
+>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[
+->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[
+-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>
+[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[
+->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>
+>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>
+>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>>+<<<<[
+->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<[->>>+<<<]>>>>+<[
+-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>
+[-]>>>>>>>>>>>>>>>+<<<<[->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[
+->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>+<<<<<<<<<<<<<<]>>>>[-<<<<+
+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>+<<<[->>>-<<<<<<+>>>]<<<[->>>+<<<]>>[->
+>>>+<<<<]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<<<]<<<[->>
+>+<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>>>>>>>>>>>>>>+<<<[->>>-<<<
+<<<+>>>]<<<[->>>+<<<]>>[->>>>+<<<<]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>
+>>>+<<<<<<<<<<<<<<]<<<[->>>+<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>
+>>>>>>>>>>>>>>+<<<<[->>>>->>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<<<<<<<[->>>>>
++<<<<<]>>[->>>+<<<]<<<<+>>>>>>>[-<<<[->>>>+<<<<<<<+>>>]<<<<[->>>>+<<<<]>
+>>>>>>>[-<<<<<<<<+>>>>>>>>]<]<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>+<<]>>[-<<+>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<[->>-<<]>>[-<<+>>]>>>>>>>
+>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>
+>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>
+>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>
+>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>
+]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+
+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<
+<+>>]>>>>>>>>>>>>+>>[-<<->>]<<[->>+<<]>>>>>>>>>>>>>>>>+>>[-<<->>]<<[->>+
+<<]>>>>>>>>>>>>>>>>+>>[-<<->>]<<[->>+<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<]<<[->
+>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>
+>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>
+>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>
+>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<
+[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>
+>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<
+]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-
+<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<
+]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<
+<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>
+>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>
+>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+
+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<
+]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->
+>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>+<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+
+>]<<]>[-]>>>>>>>>>>[->>>>+<<<<]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>>>>+
+<<<<<<<<<<<<<<]<<<[->>>+<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>>>>>
+>>>>>[->>>>+<<<<]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<<<
+]<<<[->>>+<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>>>>>>>>>>[-<<+>>]>
+>[-<<<<+>>>>]>>>>+<<<<<<<<[->>>>[->>>>>+<<+<<<]>>>>[-<<<<+>>>>]>[-<+>]<<
+<<<<<<<]>>>>>>>>[-]<[-]<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+<]>[-<+>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<
+[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+
+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>
+>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>
+>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>
+>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>
+>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>>>>>>>>>>+<<[->>-<<]>>[-<<+>>]>>>>>>>
+>>>>>+>>[-<<->>]<<[->>+<<]>>>>>>>>>>>>>>>>+>>[-<<->>]<<[->>+<<]>>>>>>>>>
+>>>>>>>+>>[-<<->>]<<[->>+<<]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[->+<]<<[->>>+<<<]>>>>+
+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<
+]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->
+>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>
+>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>
+>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>
+>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<
+[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>
+>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<
+]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-
+<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<
+]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<
+<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>
+>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>
+>>>>>>>[->+<]<<[->>>+<<<]>>>>+<[-<<<[->>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>>>>>>>>>>>>[->+<]<<[->>>+<<<]>>>>+
+<[-<<<[->>>>>+>>>>>>>>>+<<<<<<<<<<<<<<]>>>>[-<<<<+>>>>]>[-<+>]<<]>[-]>>>
+>>>>>>>[->>>>+<<<<]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<
+<<]<<<[->>>+<<<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>>>>>>>>>>[->>>>+
+<<<<]>>[->>+<<]<<<+>>>>>[-<<[->>>+>>>>>>>>>>>+<<<<<<<<<<<<<<]<<<[->>>+<<
+<]>>>>>>[-<<<<<<+>>>>>>]<]<<<<<[-]>>>>>>>>>>>>>>>>>[-<<+>>]>>[-<<<<+>>>>
+]>>>>+<<<<<<<<[->>>>[->>>>>+<<+<<<]>>>>[-<<<<+>>>>]>[-<+>]<<<<<<<<<]>>>>
+>>>>[-]<[-]<<<<<<[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<
+<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>
+>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>
+[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>
+>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>
+>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<
+<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>>>>>>>>>>>>>[-<<<<<+>>>>>]>>>>
+>>>>>>>>>>>>[-<<<<<+>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>+>>
+>+<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<[->+<]<<<
+<<<<[->>>>>>>>+<<<<<<<<]>>>>>>>>>+<[-<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<
+<]>>>>>>>>>[-<<<<<<<<<+>>>>>>>>>]>[-<+>]<<]>[-]>>>>>[-<<<+<<<+>>>>>>]<<<
+<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>
+>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-
+<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<
+<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<
+<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<
+<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>
+>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>
+[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]
+<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>
+]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<
+<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-
+]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>
+>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>
+>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<
+<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<
+[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]
+>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>
+>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-
+<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>
+]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+
+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+
+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>
+[-<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]
+>>]<[-]>>>>>>>>>>>>>>>>>>>>[-<<<+<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>[-
+<+>]>>>>[-<<<<<+>>>>>]<<<<<<+>[->>>>>[-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<]<<<<<<[->>>>>>+<<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>
+>>[->>>>+<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[->+<]<[->>+<<]>>>+<[-<<[-<<<<+>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<
+<<<<]>>>>>>]>[-]>>>>>>>>>>>[->>>>+<<<<<<<+>>>]<<<[->>>+<<<]>>>>>>[->+<]<
+[->>+<<]>>>+<[-<<[-<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]>>>[-<<<
++>>>]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>]>[-]>>>>>>>>>>>[->>>>>+<<<<<<<<<+>>
+>>]<<<<[->>>>+<<<<]>>>>>>>[->>+<<]<[->>>+<<<]<<<<+>>>>>>>[-<<<[-<<<<<+>>
+>>>>>+<<]<<<<[->>>>+<<<<]<[->+<]>>>>>>>>]<<<<<<<[-]>>>>>>[-]<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>
+>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<
+<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+
+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>
+>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]
+>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>
+>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>
+>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>
+>>>>[-<<<<<<<+>>>>>>>]>>>>>>>>>>>>>>>>[-<<<<<<<+>>>>>>>]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>+<<<<[->>>>->>>+<<<<<<<]>>>>>>>[-<<<<<<<+>>>>>>>]<<<<[->+<]<<<<
+<<<<[->>>>>>>>>+<<<<<<<<<]>>>>>>>>>>+<[-<<<<<<<<<[->>>>>>>>>>>+>>+<<<<<<
+<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[-<+>]<<]>[-]>>+>>>>>>>>>[-<<
+<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<
+<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<
+]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>
+>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>
+>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<
++>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<
+<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[
+->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+
+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<
+<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>
++>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>
+[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<
+<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>
+>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[
+-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<
+[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]
+<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>
+>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<
++>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>
+>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>
+>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<
+<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>
+>>>>>>>>>>>>>>+>>>>>>>>>[-<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<
+<<<<<[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>>>>>>>>>[-
+<<<<<<<<<->>>>>>>>>>>>+<<<]>>>[-<<<+>>>]<<<<<<<<<<<[-<+>]>>>[-<<<<+>>>>]
+<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<[
+->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>+>>>>>>>>[-<<<<<<<<->>>>>>>
++>]<[->+<]<<[-<<<<<+>>>>>]<<[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>
+>>>>[-]>>>>>>>>>>+>>>>>>>>[-<<<<<<<<->>>>>>>+>]<[->+<]<<[-<<<<<+>>>>>]<<
+[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>>>>>>+>>[-
+<<->>>>>>+<<<<]>>>>[-<<<<+>>>>]<<<<<<<[->+<]<<[->>>+<<<]<<<<+>>>>>>>[-<<
+<[->>>>+<<<<<<<+>>>]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<]<<<<<<
+<[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<[->+<]<<<<<<<<[->>>>>>>>>+<<<<
+<<<<<]>>>>>>>>>>+<[-<<<<<<<<<[->>>>>>>>>>>+>>+<<<<<<<<<<<<<]>>>>>>>>>>[-
+<<<<<<<<<<+>>>>>>>>>>]>[-<+>]<<]>[-]>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<
+<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+
+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>
+>>>>>>>>>>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>
+]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<
+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>
+>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+>>>
+>>]<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>
+>>>>>>>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<
+<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<
+]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>
+[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+>>>>>]
+<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>
+>>>>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<
++>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[
+->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[-<
++>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<<+<<<+>>>>>]<<<
+<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[->>>>[-<<<<<<+>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<]<<<<<[->>>>>+<<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>
+>>>>>[-<<+<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>[-<+>]>>>[-<<<<+>>>>]<<<<<+>[
+->>>>[-<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>+<
+<<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>>[-<+<<+>>>]<<<[->>>+<<<]>>>>>>>[-<
+<<<<+>>>>>]<<[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>
+>>>[-<+<<+>>>]<<<[->>>+<<<]>>>>>>>[-<<<<<+>>>>>]<<[-<<<+>>>]>>>+<<<<<<[-
+>>>[-<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<
+[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[->>>>>+<<<<<<<<+>>>]<<<[->>>+<<
+<]>>>>>>>[->+<]<<[->>>+<<<]<<<<+>>>>>>>[-<<<[->>>>+<<<<<<<+>>>]<<<<[->>>
+>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<]<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-<<+>>[-<<<+>[-]>>]<<<[->>>+<<
+<]>[>>>>>[-]<<<<<[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]
+>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>
+>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>
+>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>
+>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>
+>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>
+[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>
+>>>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>
+>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>
+>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-]>>>
+>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-
+]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>
+>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>
+>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]<<<]<<<[->>>>>+<<<<<<<+>>]<<[->>
++<<]>>>>>>>>+<[-<<<<<<<+>>>>>>>>[-]<]<<<<<<<[->>>>>>>+<<<<<<<]>>>>>>>>[>
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.-------
+---------------------------------------------------------<[-]]<->+<[->>>
++<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.---------
+----------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++
++++++++++++++++++++++++++++++++++.-------------------------------------<
+[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++
+++++.-------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<
+<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.------------------------
+-------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++
+++++++++++++++++++.-------------------------------------<[-]]<->+<[->>>+
+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.----------
+---------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++
+++++++++++++++++++++++++++++++++.-------------------------------------<[
+-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++++
++++.-------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<
++>>>]<<[>+++++++++++++++++++++++++++++++++++++.-------------------------
+------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++
++++++++++++++++++.-------------------------------------<[-]]<->+<[->>>+<
+<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.-----------
+--------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++
++++++++++++++++++++++++++++++++.-------------------------------------<[-
+]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++
+++.-------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+
+>>>]<<[>+++++++++++++++++++++++++++++++++++++.--------------------------
+-----------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++
+++++++++++++++++.-------------------------------------<[-]]<->+<[->>>+<<
+[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.------------
+-------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++
+++++++++++++++++++++++++++++++.-------------------------------------<[-]
+]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++++++
++.-------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>
+>>]<<[>+++++++++++++++++++++++++++++++++++++.---------------------------
+----------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++
++++++++++++++++.-------------------------------------<[-]]<->+<[->>>+<<[
+-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.-------------
+------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++
++++++++++++++++++++++++++++++.-------------------------------------<[-]]
+<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++
+.-------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>
+>]<<[>+++++++++++++++++++++++++++++++++++++.----------------------------
+---------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++
+++++++++++++++.-------------------------------------<[-]]<->+<[->>>+<<[-
+]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.--------------
+-----------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++
+++++++++++++++++++++++++++++.-------------------------------------<[-]]<
+->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++.
+-------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>
+]<<[>+++++++++++++++++++++++++++++++++++.-------------------------------
+----<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++
++++++++.-----------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<
+<<+>>>]<<[>+++++++++++++++++++++++++++++++++++.-------------------------
+----------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++
++++++++++++++.-----------------------------------<[-]]<->+<[->>>+<<[-]<]
+>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++.-------------------
+----------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++
++++++++++++++++++++.-----------------------------------<[-]]<->+<[->>>+<
+<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++++++++++++.------
+------------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]
+<<[>++++++++++++++++++++++++++++++++++++++++++.-------------------------
+-----------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++
++++++++++++++++++++++++++++.------------------------------------------<[
+-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++++
+++++++++.------------------------------------------<[-]]<->+<[->>>+<<[-]
+<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++++++++++++.----------
+--------------------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>
++++++++++++++++++++++++++++++++++++++++++++.----------------------------
+---------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++
+++++++++++++++++++++++++++.-------------------------------------------<[
+-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++++
++++++++++.-------------------------------------------<[-]]<->+<[->>>+<<[
+-]<]>>>[-<<<+>>>]<<[>+++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++.-------------------------------------------------------------
+<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++++++++
++++++++++++++++++++++++++++++.------------------------------------------
+-------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++
+++++++++++++++++++++++++++++++++.---------------------------------------
+------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++.---------------------------------------
+-------------------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>+++++++++++++
++++++++++++++++++++++++++++++++++.--------------------------------------
+--------<[-]]<->+<[->>>+<<[-]<]>>>[-<<<+>>>]<<[>++++++++++++++++++++++++
+++++++++.--------------------------------<[-]]<-[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[->+<]
+<<<<[->>>>>+<<<<<]>>>>>>+<[-<<<<<[->>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<]>>>>
+>>[-<<<<<<+>>>>>>]>[-<+>]<<]>[-]>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>
+>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>+>[-<+>]>[-<<+>>]<<<+>[-
+>>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]
+>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>
+]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<
+]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]
+>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<
+<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>
+>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<
+[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<
++>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>
+>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[-
+>>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]
+>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<]>>]<[-]>>>>>>>>>>>>>>>>>>[-<+>]>[-<<+>>
+]<<<+>[->>[-<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<]<<<[->>>+<<<]<[->+<
+]>>]<[-]>>>>>>>>>>>>>>>>>>[-<<+>>]>[-<<<+>>>]<<<<+>[->>>[->>>>+<<<<<<+>>
+]<<<<[->>>>+<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<]<[-]>>[-]>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<++++++++++.--
+--------<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+<[->+<]<<<[->>>>+<<<<]>>>>>+<[-<<<<[->>>>>>+>>>>>>>>+<<
+<<<<<<<<<<<<]>>>>>[-<<<<<+>>>>>]>[-<+>]<<]>[-]>>>>>>>>>[-<+>]>>[-<<<+>>>
+]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<
+<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<
+<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>
+>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<
+<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<
+<<]>]>>>>>>[-]>>>>>>>>>>+>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>
+>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>
+>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+
+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>
+>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+
+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>
+]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<
+<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[-
+>>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[
+-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<
+<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>
+>>>>[-]>>>>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>
+>>>>>>>>[-<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<]>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[-
+<+>]>>[-<<<+>>>]>>>+<<<<<<[->>>[-<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<]
+>>>[-<<<+>>>]<<<<<<<[->>>>>>>+<<<<<<<]>]>>>>>>[-]>>>>>>>>>>>[->>>>>+<<<<
+<]>>[->>>+<<<]<<<<+>>>>>>>[-<<<[->>>>+<<<<<<<+>>>]<<<<[->>>>+<<<<]>>>>>>
+>>[-<<<<<<<<+>>>>>>>>]<]<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]
@@ -17,7 +17,11 @@
  */
 #include <config.h>
 #include <bfc.h>
+#include <cache.h>
 #include <collect.h>
+#include <errno.h>
+#include <glib/gstdio.h>
+#include <server.h>
 #include <llvm-c/Core.h>
 #include <llvm-c/Target.h>
 #include <llvm-c/TargetMachine.h>
@@ -73,6 +77,25 @@ _open_output (BfcStream* s, const gchar* filename, GError** error)
   }
 }
 
+/*
+ * Linked executables are made executable by whoever
+ * may read them (the umask was already applied on
+ * creating the file)
+ *
+ */
+static void
+_set_executable (const gchar* filename, GError** error)
+{
+  GStatBuf st;
+
+  if (g_stat (filename, &st) < 0
+    || g_chmod (filename, st.st_mode | ((st.st_mode & 0444) >> 2)) < 0)
+  {
+    int errsv = errno;
+    g_set_error (error, G_IO_ERROR, g_io_error_from_errno (errsv), "%s: %s", filename, g_strerror (errsv));
+  }
+}
+
 static void
 _open_input (BfcStream* s, const gchar* filename, GError** error)
 {
@@ -153,6 +176,261 @@ _open_inputs (BfcStream** ss, gchar** filenames, guint n_filenames, GError** err
   *ss = _s;
 }
 
+typedef struct
+{
+  const gchar* input;
+  gchar* output;
+} BatchJob;
+
+typedef struct
+{
+  BfcOptions* opt;
+  const gchar* cachedir;
+  guint64 cachesize;
+  gint failed;
+} BatchData;
+
+enum
+{
+  batch_cache_fetch,
+  batch_collect_machine,
+  batch_open_input,
+  batch_open_output,
+  batch_codegen,
+  batch_close_input,
+  batch_close_output,
+  batch_set_executable,
+  batch_cache_store,
+  batch_max,
+};
+
+static gchar*
+_expand (const gchar* outtmpl, const gchar* filename)
+{
+  GString* string = g_string_sized_new (64);
+  gchar* dirname = g_path_get_dirname (filename);
+  gchar* basename = g_path_get_basename (filename);
+  gchar* dot = strrchr (basename, '.');
+  const gchar* p;
+
+  for (p = outtmpl; *p != 0; p++)
+  {
+    if (p [0] != '%' || p [1] == 0)
+      g_string_append_c (string, p [0]);
+    else
+    switch (*++p)
+    {
+      case 'b':
+        if (dot == NULL || dot == basename)
+          g_string_append (string, basename);
+        else
+          g_string_append_len (string, basename, dot - basename);
+        break;
+      case 'd':
+        g_string_append (string, dirname);
+        break;
+      case 'f':
+        g_string_append (string, basename);
+        break;
+      case '%':
+        g_string_append_c (string, '%');
+        break;
+      default:
+        g_string_append_c (string, '%');
+        g_string_append_c (string, p [0]);
+        break;
+    }
+  }
+
+  g_free (basename);
+  g_free (dirname);
+return g_string_free (string, FALSE);
+}
+
+static void
+_batch_one (gpointer job_, gpointer data_)
+{
+  BatchJob* job = job_;
+  BatchData* data = data_;
+  BfcOptions opt = *data->opt;
+  BfcStream input = {0};
+  GError* tmperr = NULL;
+  gchar* key = NULL;
+  int i;
+
+  /*
+   * Every job gets its own options, streams and
+   * target machine (bfc_main gets its own context
+   * as well), so nothing but the read only options
+   * template is shared between workers
+   *
+   */
+  opt.inputs = &input;
+  opt.n_inputs = 1;
+  opt.machine = NULL;
+  opt.output.filename = NULL;
+  opt.output.stream = NULL;
+
+  for (i = 0; i < batch_max; i++)
+  {
+    switch (i)
+    {
+      case batch_cache_fetch:
+        if (data->cachedir != NULL)
+        {
+          key = cache_key (&opt, opt.arch, opt.tune, opt.features, (gchar**) & job->input, 1, &tmperr);
+          if (key != NULL && cache_fetch (data->cachedir, key, job->output, &tmperr))
+          {
+            if (opt.link)
+              _set_executable (job->output, &tmperr);
+            i = batch_max;
+          }
+        }
+        goto check;
+      case batch_collect_machine:
+        if (data->opt->machine != NULL)
+        {
+          LLVMTargetRef target = LLVMGetTargetMachineTarget (data->opt->machine);
+          opt.machine = LLVMCreateTargetMachine (target, opt.arch, opt.tune, opt.features, LLVMCodeGenLevelDefault, opt.reloc, opt.mmodel);
+        }
+        goto check;
+      case batch_open_input:
+        _open_input (&input, job->input, &tmperr);
+        goto check;
+      case batch_open_output:
+        _open_output (& opt.output, job->output, &tmperr);
+        goto check;
+      case batch_codegen:
+        if (opt.emitbc)
+          bfc_bytecode (&opt, &tmperr);
+        else
+          bfc_main (&opt, &tmperr);
+        goto check;
+      case batch_close_input:
+        g_input_stream_close (input.stream, NULL, &tmperr);
+        goto check;
+      case batch_close_output:
+        g_output_stream_close (opt.output.stream, NULL, &tmperr);
+        goto check;
+      case batch_set_executable:
+        if (opt.link)
+          _set_executable (job->output, &tmperr);
+        goto check;
+      case batch_cache_store:
+        if (key != NULL)
+        {
+          cache_store (data->cachedir, key, job->output, data->cachesize, &tmperr);
+          if (G_UNLIKELY (tmperr != NULL))
+          {
+            g_warning ("%s", tmperr->message);
+            g_clear_error (&tmperr);
+          }
+        }
+        goto check;
+
+      check:
+        if (G_UNLIKELY (tmperr != NULL))
+        {
+          g_warning ("%s: %s", job->input, tmperr->message);
+          g_atomic_int_inc (& data->failed);
+          g_error_free (tmperr);
+          i = batch_max;
+        }
+        break;
+    }
+  }
+
+  if (opt.machine != NULL)
+    LLVMDisposeTargetMachine (opt.machine);
+    _g_object_unref0 (opt.output.stream);
+    _g_object_unref0 (input.stream);
+    _g_free0 (key);
+}
+
+static void
+_batch (BfcOptions* opt, gchar** filenames, guint n_filenames, const gchar* outtmpl, gint jobs, const gchar* cachedir, guint64 cachesize, GError** error)
+{
+  BatchData data = { opt, cachedir, cachesize, 0, };
+  BatchJob* batch = g_new0 (BatchJob, n_filenames);
+  GHashTable* outputs = g_hash_table_new (g_str_hash, g_str_equal);
+  GThreadPool* pool = NULL;
+  GError* tmperr = NULL;
+  guint i;
+
+  if (opt->run || opt->interpret)
+    g_set_error
+    (&tmperr,
+     G_IO_ERROR,
+     G_IO_ERROR_FAILED,
+     "Batch compilation writes outputs, it can not run programs");
+
+  for (i = 0; i < n_filenames && tmperr == NULL; i++)
+  {
+    const gchar* other;
+
+    batch [i].input = filenames [i];
+    batch [i].output = _expand (outtmpl, filenames [i]);
+
+    if (!g_strcmp0 (filenames [i], "-"))
+      g_set_error
+      (&tmperr,
+       G_IO_ERROR,
+       G_IO_ERROR_FAILED,
+       "Standard input can not be batch compiled");
+    else
+    if (!g_strcmp0 (batch [i].output, filenames [i]))
+      g_set_error
+      (&tmperr,
+       G_IO_ERROR,
+       G_IO_ERROR_FAILED,
+       "%s would be overwritten by its own output",
+        filenames [i]);
+    else
+    if ((other = g_hash_table_lookup (outputs, batch [i].output)) != NULL)
+      g_set_error
+      (&tmperr,
+       G_IO_ERROR,
+       G_IO_ERROR_FAILED,
+       "Both %s and %s would be written to %s",
+        other, filenames [i], batch [i].output);
+    else
+      g_hash_table_insert (outputs, batch [i].output, (gpointer) filenames [i]);
+  }
+
+  /*
+   * Jobs open their files only once they run, so no more
+   * than a couple of them per worker are open at any time
+   *
+   */
+  if (G_LIKELY (tmperr == NULL))
+  {
+    pool = g_thread_pool_new (_batch_one, &data, jobs, FALSE, &tmperr);
+
+    if (G_LIKELY (tmperr == NULL))
+    {
+      for (i = 0; i < n_filenames; i++)
+        g_thread_pool_push (pool, & batch [i], NULL);
+        g_thread_pool_free (pool, FALSE, TRUE);
+
+      if (data.failed > 0)
+        g_set_error
+        (&tmperr,
+         G_IO_ERROR,
+         G_IO_ERROR_FAILED,
+         "%i of %u inputs failed to compile",
+          data.failed, n_filenames);
+    }
+  }
+
+  if (G_UNLIKELY (tmperr != NULL))
+    g_propagate_error (error, tmperr);
+
+  for (i = 0; i < n_filenames; i++)
+    g_free (batch [i].output);
+    g_hash_table_unref (outputs);
+    g_free (batch);
+}
+
 typedef struct
 {
   GOptionContext* context;
@@ -244,21 +522,61 @@ dohelp (const gchar* option_name, const gchar* value, gpointer data_, GError** e
 return TRUE;
 }
 
+static void
+_forward (gchar** args)
+{
+  gchar** dst = args;
+  gchar** src = args;
+
+  /*
+   * Drops client only options, so
+   * the server sees the rest as is
+   *
+   */
+  for (; *src != NULL; src++)
+  {
+    if (!g_strcmp0 (*src, "--connect"))
+      g_free (*src);
+    else
+    if (g_str_has_prefix (*src, "--socket="))
+      g_free (*src);
+    else
+    if (!g_strcmp0 (*src, "--socket"))
+    {
+      g_free (*src);
+      if (src [1] != NULL)
+        g_free (*++src);
+    }
+    else
+      *dst++ = *src;
+  }
+
+  *dst = NULL;
+}
+
 enum
 {
+  pass_connect,
+  pass_collect_belt,
   pass_collect_codegen,
+  pass_collect_optimize,
+  pass_cache_fetch,
   pass_collect_machine,
+  pass_serve,
+  pass_batch,
   pass_open_inputs,
   pass_open_output,
   pass_codegen,
   pass_close_inputs,
   pass_flush_output,
   pass_close_output,
+  pass_set_executable,
+  pass_cache_store,
   pass_max,
 };
 
-int
-main (int argc, char* argv[])
+static gint
+_main (gint argc, gchar** argv)
 {
   GOptionContext* context = NULL;
   GOptionGroup* group = NULL;
@@ -269,22 +587,46 @@ main (int argc, char* argv[])
   GString* summary = g_string_sized_new (64);
   HelpData helpdata = {0};
 
-  gint olevel = 2;
-  gsize beltsz = 1024;
+  gint64 beltsz = 0;
+  gint cellbits = 8;
+  gint jobs = 0;
+  gint status = 0;
+  gint64 evalsteps = 1000000;
   gboolean assemble = FALSE;
   gboolean compile = FALSE;
+  gboolean beltwrap = FALSE;
+  gboolean cache = FALSE;
+  gboolean cachestats = FALSE;
+  gint64 cachesize = 256 << 20;
+  gboolean checkbelt = FALSE;
   gboolean checkio = TRUE;
+  gboolean connect = FALSE;
+  gboolean emitbc = FALSE;
   gboolean emitll = FALSE;
+  gboolean interpret = FALSE;
+  gboolean run = FALSE;
+  gboolean server = FALSE;
+  gboolean lazybelt = FALSE;
   gboolean static_ = FALSE;
   gboolean strict = FALSE;
+  gboolean tiered = FALSE;
   gboolean fpic = FALSE;
   gboolean fpie = FALSE;
   gboolean fPIC = FALSE;
   gboolean fPIE = FALSE;
   const gchar* mmodel = "default";
   const gchar* arch = NULL;
+  const gchar* olevel = "2";
+  const gchar* passes = NULL;
+  gchar* profgen = NULL;
+  gchar* profuse = NULL;
+  gchar* cachedir = NULL;
+  gchar* cachekey = NULL;
+  gchar* sockpath = NULL;
+  gchar** args = g_strdupv (argv);
   const gchar* features = NULL;
   const gchar* output = "a.out";
+  const gchar* outtmpl = NULL;
   const gchar* tune = NULL;
 
   const GOptionEntry helps[] =
@@ -301,25 +643,46 @@ main (int argc, char* argv[])
     { "arch", 0, 0, G_OPTION_ARG_STRING, &arch, "Generate code for target <TARGET>", "TARGET", },
     { "assemble", 'S', 0, G_OPTION_ARG_NONE, &assemble, "Assemble only; do not compile or link", NULL, },
     { "compile", 'c', 0, G_OPTION_ARG_NONE, &compile, "Compile only; do not assemble or link", NULL, },
-    { "emit-llvm", 0, 0, G_OPTION_ARG_NONE, &emitll, "Emit LLVM IR code (human readable format)", NULL, },
+    { "connect", 0, 0, G_OPTION_ARG_NONE, &connect, "Hand the compilation over to a running server (see --server)", NULL, },
+    { "emit-bytecode", 0, 0, G_OPTION_ARG_NONE, &emitbc, "Emit interpreter bytecode (see --interpret)", NULL, },
+    { "emit-llvm", 0, 0, G_OPTION_ARG_NONE, &emitll, "Emit LLVM bitcode, for link-time optimization (or IR code in human readable format, with -S)", NULL, },
     { "features", 'F', 0, G_OPTION_ARG_STRING, &features, "Specify target-specific features to <FEATURES>", "FEATURES", },
-    { "optimize", 'O', 0, G_OPTION_ARG_INT, &olevel, "Optimize code as <LEVEL> strong", "LEVEL", },
+    { "interpret", 'i', 0, G_OPTION_ARG_NONE, &interpret, "Run programs (or bytecode) right away in the interpreter, without generating code", NULL, },
+    { "jobs", 'j', 0, G_OPTION_ARG_INT, &jobs, "Compile every input into its own output (see --output-template), <N> at a time (by default, one per processor)", "N", },
+    { "optimize", 'O', 0, G_OPTION_ARG_STRING, &olevel, "Optimize code as <LEVEL> strong (0 to 3), or for size (s, z)", "LEVEL", },
     { "output", 'o', 0, G_OPTION_ARG_STRING, &output, "Place the output info <FILE>", "FILE", },
+    { "output-template", 0, 0, G_OPTION_ARG_STRING, &outtmpl, "Name each input's output after <TEMPLATE>, where %d, %f and %b stand for the input directory, file name and file name without extension", "TEMPLATE", },
     { "pic", 0, 0, G_OPTION_ARG_NONE, &fpic, "Generate position-independient code if possible (small mode)", NULL, },
     { "pie", 0, 0, G_OPTION_ARG_NONE, &fpie, "Generate position-independient code for executables if possible (small mode)", NULL, },
     { "PIC", 0, 0, G_OPTION_ARG_NONE, &fPIC, "Generate position-independient code if possible (large mode)", NULL, },
     { "PIE", 0, 0, G_OPTION_ARG_NONE, &fPIE, "Generate position-independient code for executables if possible (large mode)", NULL, },
+    { "run", 'r', 0, G_OPTION_ARG_NONE, &run, "Run programs right away (just-in-time compiled) instead of writing them out", NULL, },
+    { "server", 0, 0, G_OPTION_ARG_NONE, &server, "Serve compilations over a local socket, keeping targets set up between them", NULL, },
+    { "socket", 0, 0, G_OPTION_ARG_FILENAME, &sockpath, "Use <PATH> as the server socket (by default, under the user runtime directory)", "PATH", },
     { "tune", 0, 0, G_OPTION_ARG_STRING, &tune, "Schedule code for cpu <CPU>", "CPU", },
     { "static", 's', 0, G_OPTION_ARG_NONE, &static_, "Do not link against shared libraries", NULL, },
     { "strict", 0, 0, G_OPTION_ARG_NONE, &strict, "Perform strict code parsing", NULL, },
+    { "tiered", 0, 0, G_OPTION_ARG_NONE, &tiered, "Run programs right away, interpreted while their hot loops are compiled", NULL, },
     { NULL, 0, 0, 0, NULL, NULL, NULL, },
   };
 
   const GOptionEntry others[] =
   {
     { "address-mode", 0, 0, G_OPTION_ARG_STRING, &mmodel, "Use given address mode", NULL, },
-    { "belt-size", 0, 0, G_OPTION_ARG_INT, &beltsz, "Override default belt size (in whole units)", NULL, },
+    { "belt-size", 0, 0, G_OPTION_ARG_INT64, &beltsz, "Override belt size (in whole units; by default, as many as the program is known to need)", NULL, },
+    { "belt-wrap", 0, 0, G_OPTION_ARG_NONE, &beltwrap, "Round the belt size up to a power of two and wrap the cursor around it", NULL, },
+    { "cache", 0, 0, G_OPTION_ARG_NONE, &cache, "Reuse outputs from previous compilations of the same sources and options", NULL, },
+    { "cache-dir", 0, 0, G_OPTION_ARG_FILENAME, &cachedir, "Keep the compilation cache in <DIR> (by default, under the user cache directory)", "DIR", },
+    { "cache-size", 0, 0, G_OPTION_ARG_INT64, &cachesize, "Evict the least recently used cache entries beyond <BYTES>", "BYTES", },
+    { "cache-stats", 0, 0, G_OPTION_ARG_NONE, &cachestats, "Show compilation cache statistics", NULL, },
+    { "cell-bits", 0, 0, G_OPTION_ARG_INT, &cellbits, "Use cells <BITS> wide (8, 16, 32 or 64)", "BITS", },
+    { "check-belt", 0, 0, G_OPTION_ARG_NONE, &checkbelt, "Check belt accesses do not fall outside it (exiting with status -2 if they do)", NULL, },
     { "check-io", 0, 0, G_OPTION_ARG_NONE, &checkio, "Perform check after every I/O call", NULL, },
+    { "eval-steps", 0, 0, G_OPTION_ARG_INT64, &evalsteps, "Evaluate up to <STEPS> operations at compile time (0 disables it)", "STEPS", },
+    { "lazy-belt", 0, 0, G_OPTION_ARG_NONE, &lazybelt, "Reserve the belt with mmap and commit its pages on first use", NULL, },
+    { "passes", 0, 0, G_OPTION_ARG_STRING, &passes, "Run the LLVM pass pipeline <PIPELINE> (as opt's -passes= takes it) instead of the one for the optimization level", "PIPELINE", },
+    { "profile-generate", 0, 0, G_OPTION_ARG_FILENAME, &profgen, "Count how often loops run, writing the counts out to <FILE> whenever the program exits", "FILE", },
+    { "profile-use", 0, 0, G_OPTION_ARG_FILENAME, &profuse, "Optimize for the loop counts in <FILE> (see --profile-generate)", "FILE", },
     { NULL, 0, 0, 0, NULL, NULL, NULL, },
   };
 
@@ -374,22 +737,88 @@ main (int argc, char* argv[])
   {
     if (helpdata.helped)
       return 0;
+    if (sockpath == NULL)
+      sockpath = server_socket ();
+    if (cachedir == NULL)
+      cachedir = g_build_filename (g_get_user_cache_dir (), "bfc", NULL);
+    if (cachestats)
+    {
+      cache_stats (cachedir, MAX (0, cachesize));
+      if (argc < 2)
+        return 0;
+    }
 
     BfcOptions opt = {0};
       opt.assemble = assemble;
+      opt.checkbelt = checkbelt;
       opt.checkio = checkio;
       opt.compile = compile;
+      opt.emitbc = emitbc;
       opt.emitll = emitll;
-      opt.olevel = olevel;
+      opt.interpret = interpret;
+      opt.run = run || tiered;
       opt.static_ = static_;
       opt.strict = strict;
-      opt.beltsz = beltsz;
+      opt.tiered = tiered;
+      opt.evalsteps = MAX (0, evalsteps);
+      opt.profgen = profgen;
+      opt.profuse = profuse;
+      opt.link = !compile && !assemble && !emitll && !emitbc && !interpret && !opt.run;
+
+    /*
+     * Programs run right away write nothing out, unless
+     * emitting bytecode (which wins over running it)
+     *
+     */
+    gboolean emits = opt.emitbc || (!opt.run && !opt.interpret);
+
+    /*
+     * Either option alone asks for a batch compilation
+     *
+     */
+    gboolean batch = jobs > 0 || outtmpl != NULL;
+
+    if (batch && jobs <= 0)
+      jobs = g_get_num_processors ();
+    if (batch && outtmpl == NULL)
+    {
+      if (opt.emitbc)
+        outtmpl = "%d/%b.bfcb";
+      else
+      if (opt.emitll)
+        outtmpl = opt.assemble ? "%d/%b.ll" : "%d/%b.bc";
+      else
+      if (opt.link)
+        outtmpl = "%d/%b";
+      else
+        outtmpl = opt.assemble ? "%d/%b.s" : "%d/%b.o";
+    }
 
     int i, j;
     for (i = 0; i < pass_max; i++)
     {
       switch (i)
       {
+        case pass_connect:
+          if (connect)
+          {
+            if (server)
+              g_set_error
+              (&tmperr,
+               G_IO_ERROR,
+               G_IO_ERROR_FAILED,
+               "Can not have both server and connect");
+            else
+            {
+              _forward (args);
+              status = server_connect (sockpath, args, &tmperr);
+              i = pass_max;
+            }
+          }
+          goto check;
+        case pass_collect_belt:
+          collect_belt (&opt, beltsz, cellbits, lazybelt, beltwrap, &tmperr);
+          goto check;
         case pass_collect_codegen:
           {
             guint pic = COLLECT_PIC (fpic, fPIC);
@@ -397,19 +826,61 @@ main (int argc, char* argv[])
             collect_codegen (&opt, static_, pic, pie, mmodel, &tmperr);
           }
           goto check;
+        case pass_collect_optimize:
+          collect_optimize (&opt, olevel, passes, &tmperr);
+          goto check;
+        case pass_cache_fetch:
+          if (cache && emits && !batch && !server && g_strcmp0 (output, "-"))
+          {
+            cachekey = cache_key (&opt, arch, tune, features, & argv [1], argc - 1, &tmperr);
+            if (cachekey != NULL && cache_fetch (cachedir, cachekey, output, &tmperr))
+            {
+              if (opt.link)
+                _set_executable (output, &tmperr);
+              i = pass_max;
+            }
+          }
+          goto check;
         case pass_collect_machine:
-          collect_machine (&opt, arch, tune, features, &tmperr);
+          if (!opt.interpret && !opt.emitbc)
+            collect_machine (&opt, arch, tune, features, &tmperr);
+          goto check;
+        case pass_serve:
+          if (server)
+          {
+            bfc_initialize ();
+            if (opt.machine != NULL)
+              collect_warm (&opt, arch, tune, features);
+
+            server_listen (sockpath, _main, &tmperr);
+            i = pass_max;
+          }
+          goto check;
+        case pass_batch:
+          if (batch)
+          {
+            _batch (&opt, & argv [1], argc - 1, outtmpl, jobs, cache ? cachedir : NULL, MAX (0, cachesize), &tmperr);
+            if (opt.machine != NULL)
+              LLVMDisposeTargetMachine (opt.machine);
+            i = pass_max;
+          }
           goto check;
         case pass_open_inputs:
           opt.n_inputs = argc - 1;
           _open_inputs (& opt.inputs, & argv [1], opt.n_inputs, &tmperr);
           goto check;
         case pass_open_output:
-          _open_output (& opt.output, output, &tmperr);
+          if (emits)
+            _open_output (& opt.output, output, &tmperr);
           goto check;
         case pass_codegen:
-          bfc_main (&opt, &tmperr);
-          LLVMDisposeTargetMachine (opt.machine);
+          if (opt.interpret || opt.emitbc)
+            bfc_bytecode (&opt, &tmperr);
+          else
+          {
+            bfc_main (&opt, &tmperr);
+            LLVMDisposeTargetMachine (opt.machine);
+          }
           goto check;
         case pass_close_inputs:
           for (j = 0; j < opt.n_inputs; ++j)
@@ -421,10 +892,33 @@ main (int argc, char* argv[])
             g_free (opt.inputs);
           goto check;
         case pass_flush_output:
-          g_output_stream_flush (opt.output.stream, NULL, &tmperr);
+          if (emits)
+            g_output_stream_flush (opt.output.stream, NULL, &tmperr);
           goto check;
         case pass_close_output:
-          g_output_stream_close (opt.output.stream, NULL, &tmperr);
+          if (emits)
+            g_output_stream_close (opt.output.stream, NULL, &tmperr);
+          goto check;
+        case pass_set_executable:
+          if (emits && opt.link && g_strcmp0 (output, "-"))
+            _set_executable (output, &tmperr);
+          goto check;
+        case pass_cache_store:
+          if (cachekey != NULL)
+          {
+            cache_store (cachedir, cachekey, output, MAX (0, cachesize), &tmperr);
+
+            /*
+             * An unwritable cache only costs the
+             * next compilation, not this one
+             *
+             */
+            if (G_UNLIKELY (tmperr != NULL))
+            {
+              g_warning ("%s", tmperr->message);
+              g_clear_error (&tmperr);
+            }
+          }
           goto check;
 
         check:
@@ -444,5 +938,13 @@ main (int argc, char* argv[])
       }
     }
   }
-return 0;
+
+  g_strfreev (args);
+return status;
+}
+
+int
+main (int argc, char* argv[])
+{
+return _main (argc, argv);
 }
@@ -39,20 +39,34 @@ struct _BfcStream
 struct _BfcOptions
 {
   gsize beltsz;
+  gsize evalsteps;
   guint assemble : 1;
+  guint beltwrap : 1;
+  guint cellbits : 7;
+  guint checkbelt : 1;
   guint checkio : 1;
   guint compile : 1;
+  guint emitbc : 1;
   guint emitll : 1;
+  guint interpret : 1;
+  guint lazybelt : 1;
+  guint link : 1;
   guint mmodel : 3;
   guint olevel : 6;
   guint pic : 2;
   guint pie : 2;
   guint reloc : 3;
+  guint run : 1;
+  guint sizelevel : 2;
   guint static_ : 1;
   guint strict : 1;
+  guint tiered : 1;
 
   const gchar* arch;
   const gchar* features;
+  const gchar* passes;
+  const gchar* profgen;
+  const gchar* profuse;
   const gchar* tune;
   gpointer machine;
 
@@ -60,9 +74,13 @@ struct _BfcOptions
   guint n_inputs;
 };
 
+G_GNUC_INTERNAL void
+bfc_initialize (void);
 G_GNUC_INTERNAL void
 bfc_main (BfcOptions* opt, GError** error);
 G_GNUC_INTERNAL void
+bfc_bytecode (BfcOptions* opt, GError** error);
+G_GNUC_INTERNAL void
 bfc_optimize (BfcOptions* opt, gpointer module, GError** error);
 G_GNUC_INTERNAL void
 bfc_dump (BfcOptions* opt, gpointer module_, GError** error);
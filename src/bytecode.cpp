@@ -0,0 +1,243 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <bytecode.hpp>
+#include <string.h>
+
+using namespace Bfc;
+
+G_DEFINE_QUARK (bfc-bytecode-error-quark, bfc_bytecode_error);
+#define BFC_BYTECODE_ERROR (bfc_bytecode_error_quark ())
+#define BFC_BYTECODE_ERROR_FAILED (0)
+
+static const gchar MAGIC [4] = { 'B', 'F', 'C', 'B', };
+
+Bytecode::Bytecode (GBytes* image)
+{
+  bind (image);
+}
+
+/*
+ * Points the sections at their place in image (taking it over)
+ *
+ */
+void
+Bytecode::bind (GBytes* image)
+{
+  auto base = (const guint8*) g_bytes_get_data (image, nullptr);
+
+  this->image = image;
+  header = (const Header*) base;
+  insns = (const Insn*) (header + 1);
+  cells = (const guint64*) (insns + header->n_insns);
+  data = (const gchar*) (cells + header->n_cells);
+}
+
+Bytecode::Bytecode (BfcOptions* opt, const Program* program)
+{
+  auto& ops = program->ops;
+  auto& initial = program->initial;
+  auto text = std::string (initial.output);
+  auto code = std::vector<Insn> ();
+  Header head;
+
+  code.reserve (ops.size () + 1);
+
+  for (auto& op : ops)
+  {
+    auto insn = Insn { (guint32) op.code, op.offset, op.source, 0, op.value };
+
+    switch (op.code)
+    {
+      case op_open:
+      case op_close:
+        insn.jump = (guint32) (op.jump + 1);
+        break;
+      case op_print:
+        {
+          auto& string = program->strings [op.value];
+
+          insn.value = text.size ();
+          insn.jump = (guint32) string.size ();
+          text.append (string);
+        }
+        break;
+      default:
+        break;
+    }
+
+    code.push_back (insn);
+  }
+
+  code.push_back (Insn { insn_halt, 0, 0, 0, 0 });
+
+  memcpy (head.magic, MAGIC, sizeof (MAGIC));
+  head.version = BYTECODE_VERSION;
+  head.cellbits = opt->cellbits;
+  head.flags = (opt->checkbelt ? BYTECODE_CHECKBELT : 0)
+             | (opt->checkio ? BYTECODE_CHECKIO : 0)
+             | (opt->beltwrap ? BYTECODE_WRAP : 0);
+  head.beltsz = program->beltsz;
+  head.cursor = initial.cursor;
+  head.n_insns = code.size ();
+  head.n_cells = initial.cells.size ();
+  head.n_data = text.size ();
+  head.n_output = initial.output.size ();
+
+  auto size = sizeof (Header) + code.size () * sizeof (Insn) + initial.cells.size () * sizeof (guint64) + text.size ();
+  auto bytes = (guint8*) g_malloc (size);
+  auto at = bytes;
+
+  memcpy (at, &head, sizeof (Header));
+  at += sizeof (Header);
+  memcpy (at, code.data (), code.size () * sizeof (Insn));
+  at += code.size () * sizeof (Insn);
+  memcpy (at, initial.cells.data (), initial.cells.size () * sizeof (guint64));
+  at += initial.cells.size () * sizeof (guint64);
+  memcpy (at, text.data (), text.size ());
+
+  bind (g_bytes_new_take (bytes, size));
+}
+
+Bytecode::~Bytecode ()
+{
+  g_bytes_unref (image);
+}
+
+/*
+ * Maps an image from filename, checking it is sound enough to
+ * run (as it may come from anywhere): sizes have to add up and
+ * jumps have to land on their matching instructions. Files which
+ * are not images at all yield nullptr without error, so they are
+ * taken as sources instead
+ *
+ */
+Bytecode*
+Bytecode::load (const gchar* filename, GError** error)
+{
+  auto tmperr = (GError*) nullptr;
+  auto mapped = g_mapped_file_new (filename, FALSE, &tmperr);
+  auto image = (GBytes*) nullptr;
+  gsize size;
+
+  if (G_UNLIKELY (tmperr != nullptr))
+  {
+    g_propagate_error (error, tmperr);
+    return nullptr;
+  }
+
+  image = g_mapped_file_get_bytes (mapped);
+    g_mapped_file_unref (mapped);
+
+  auto base = (const guint8*) g_bytes_get_data (image, &size);
+  auto head = (const Header*) base;
+
+  if (size < sizeof (Header) || memcmp (head->magic, MAGIC, sizeof (MAGIC)) != 0)
+  {
+    g_bytes_unref (image);
+    return nullptr;
+  }
+
+#define THROW(...) \
+  G_STMT_START { \
+    g_set_error \
+    (error, \
+     BFC_BYTECODE_ERROR, \
+     BFC_BYTECODE_ERROR_FAILED, \
+     __VA_ARGS__); \
+    g_bytes_unref (image); \
+    return nullptr; \
+  } G_STMT_END
+
+  if (head->version != BYTECODE_VERSION)
+    THROW ("%s: unsupported bytecode version", filename);
+
+  auto room = (guint64) (size - sizeof (Header));
+
+  if (head->n_insns == 0 || head->n_insns > room / sizeof (Insn))
+    THROW ("%s: truncated bytecode", filename);
+  room -= head->n_insns * sizeof (Insn);
+  if (head->n_cells > room / sizeof (guint64))
+    THROW ("%s: truncated bytecode", filename);
+  room -= head->n_cells * sizeof (guint64);
+  if (head->n_data != room || head->n_output > head->n_data)
+    THROW ("%s: truncated bytecode", filename);
+
+  switch (head->cellbits)
+  {
+    case 8: case 16: case 32: case 64:
+      break;
+    default:
+      THROW ("%s: invalid cell width %u", filename, head->cellbits);
+  }
+
+  if (head->beltsz == 0 || head->cursor >= head->beltsz || head->n_cells > head->beltsz
+    || ((head->flags & BYTECODE_WRAP) && (head->beltsz & (head->beltsz - 1)) != 0)
+    || head->beltsz > (G_MAXSIZE / 4) / (head->cellbits / 8))
+    THROW ("%s: invalid belt", filename);
+
+  auto insns = (const Insn*) (head + 1);
+  auto last = head->n_insns - 1;
+
+  for (guint64 i = 0; i <= last; ++i)
+  {
+    auto& insn = insns [i];
+
+    switch (insn.code)
+    {
+      case op_open:
+        if (insn.jump == 0 || insn.jump > last || insns [insn.jump - 1].code != op_close || insns [insn.jump - 1].jump != i + 1)
+          THROW ("%s: unbalanced jump at instruction %" G_GUINT64_FORMAT, filename, i);
+        break;
+      case op_close:
+        if (insn.jump == 0 || insn.jump > i || insns [insn.jump - 1].code != op_open || insns [insn.jump - 1].jump != i + 1)
+          THROW ("%s: unbalanced jump at instruction %" G_GUINT64_FORMAT, filename, i);
+        break;
+      case op_print:
+        if (insn.value < 0 || (guint64) insn.value > head->n_data || insn.jump > head->n_data - insn.value)
+          THROW ("%s: invalid text at instruction %" G_GUINT64_FORMAT, filename, i);
+        break;
+      case op_write:
+        if (insn.value < 0)
+          THROW ("%s: invalid write at instruction %" G_GUINT64_FORMAT, filename, i);
+        break;
+      case insn_halt:
+        if (i != last)
+          THROW ("%s: misplaced halt at instruction %" G_GUINT64_FORMAT, filename, i);
+        break;
+      default:
+        if (insn.code > insn_halt)
+          THROW ("%s: invalid opcode at instruction %" G_GUINT64_FORMAT, filename, i);
+        break;
+    }
+  }
+
+  if (insns [last].code != insn_halt)
+    THROW ("%s: missing halt", filename);
+#undef THROW
+  return new Bytecode (image);
+}
+
+void
+Bytecode::write (GOutputStream* stream, GError** error) const
+{
+  gsize size;
+  auto bytes = g_bytes_get_data (image, &size);
+
+  g_output_stream_write_all (stream, bytes, size, nullptr, nullptr, error);
+}
@@ -0,0 +1,97 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_BYTECODE__
+#define __BFC_BYTECODE__ 1
+#include <bfc.h>
+#include <program.hpp>
+
+namespace Bfc
+{
+  /*
+   * Bytecode images are laid out as a Header, then n_insns
+   * instructions, n_cells initial cells (as 64 bit words) and
+   * n_data bytes of text, all in host byte order (a foreign image
+   * just reads as a wrong version) and aligned so that a mapped
+   * file runs in place, with no parse step at all
+   *
+   */
+  static const guint32 BYTECODE_VERSION = 1;
+
+  enum
+  {
+    BYTECODE_CHECKBELT = 1 << 0,
+    BYTECODE_CHECKIO = 1 << 1,
+    BYTECODE_WRAP = 1 << 2,
+  };
+
+  struct Header
+  {
+    gchar magic [4];      /* "BFCB" */
+    guint32 version;
+    guint32 cellbits;
+    guint32 flags;
+    guint64 beltsz;
+    guint64 cursor;
+    guint64 n_insns;
+    guint64 n_cells;
+    guint64 n_data;
+    guint64 n_output;     /* data [0, n_output) is written before running */
+  };
+
+  /*
+   * One op (see Bfc::OpCode) per instruction, at the same index,
+   * and a final insn_halt. Jumps are turned into the index of
+   * the instruction to go on with (past the matching op_close for
+   * op_open, the first of the body for op_close), and the text of
+   * op_print is data [value, value + jump)
+   *
+   */
+  enum { insn_halt = op_print + 1 };
+
+  struct Insn
+  {
+    guint32 code;
+    gint32 offset;
+    gint32 source;
+    guint32 jump;
+    gint64 value;
+  };
+
+  class Bytecode
+  {
+  public:
+    Bytecode (BfcOptions* opt, const Program* program);
+    Bytecode (const Bytecode& bytecode) = delete;
+    ~Bytecode ();
+
+    static Bytecode* load (const gchar* filename, GError** error);
+    void write (GOutputStream* stream, GError** error) const;
+
+    const Header* header;
+    const Insn* insns;
+    const guint64* cells;
+    const gchar* data;
+  private:
+    Bytecode (GBytes* image);
+    void bind (GBytes* image);
+
+    GBytes* image;
+  };
+}
+
+#endif // __BFC_BYTECODE__
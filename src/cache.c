@@ -0,0 +1,401 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <cache.h>
+#include <errno.h>
+#include <glib/gstdio.h>
+#include <llvm-c/Target.h>
+#include <string.h>
+
+/*
+ * Anything which changes what gets written out for the
+ * same sources must change this tag (or go into the key)
+ *
+ */
+#define CACHE_TAG PACKAGE_STRING " (LLVM " LLVM_VERSION_STRING ")"
+#define CACHE_STATS "stats"
+#define CACHE_GROUP "cache"
+
+/*
+ * Entries being stored (see cache_store) are written aside
+ * first: any left there longer than this (in seconds) were
+ * abandoned midway (by a compiler which died, say)
+ *
+ */
+#define CACHE_STALE (60 * 60)
+
+#define THROW_ERRNO(what,path) \
+  G_STMT_START { \
+    int __errsv = errno; \
+    g_set_error \
+    (error, \
+     G_IO_ERROR, \
+     g_io_error_from_errno (__errsv), \
+     "%s: %s: %s", \
+      (what), (path), \
+      g_strerror (__errsv)); \
+    return; \
+  } G_STMT_END
+
+typedef struct
+{
+  gchar* name;
+  guint64 size;
+  gint64 mtime;
+} Entry;
+
+static inline void
+_update_string (GChecksum* checksum, const gchar* value)
+{
+  value = value == NULL ? "" : value;
+  g_checksum_update (checksum, (const guchar*) value, strlen (value) + 1);
+}
+
+static inline void
+_update_word (GChecksum* checksum, guint64 value)
+{
+  value = GUINT64_TO_LE (value);
+  g_checksum_update (checksum, (const guchar*) &value, sizeof (value));
+}
+
+static gboolean
+_update_file (GChecksum* checksum, const gchar* filename, GError** error)
+{
+  GMappedFile* mapped = NULL;
+  GError* tmperr = NULL;
+
+  mapped = g_mapped_file_new (filename, FALSE, &tmperr);
+  if (G_UNLIKELY (tmperr != NULL))
+  {
+    g_propagate_error (error, tmperr);
+    return FALSE;
+  }
+
+  gsize length = g_mapped_file_get_length (mapped);
+  const gchar* contents = g_mapped_file_get_contents (mapped);
+
+  _update_word (checksum, length);
+  g_checksum_update (checksum, (const guchar*) contents, length);
+  g_mapped_file_unref (mapped);
+return TRUE;
+}
+
+gchar*
+cache_key (BfcOptions* opt, const gchar* arch, const gchar* tune, const gchar* features, gchar** filenames, guint n_filenames, GError** error)
+{
+  GChecksum* checksum = NULL;
+  gchar* key = NULL;
+  guint i;
+
+  /*
+   * Standard input can not be read twice, so
+   * whatever it holds is just never cached
+   *
+   */
+  for (i = 0; i < n_filenames; i++)
+  if (!g_strcmp0 (filenames [i], "-"))
+    return NULL;
+
+  checksum = g_checksum_new (G_CHECKSUM_SHA256);
+
+  _update_string (checksum, CACHE_TAG);
+  _update_string (checksum, arch == NULL ? LLVM_HOST_TRIPLE : arch);
+  _update_string (checksum, tune);
+  _update_string (checksum, features);
+  _update_string (checksum, opt->passes);
+  _update_string (checksum, opt->profgen);
+
+  _update_word (checksum, opt->assemble);
+  _update_word (checksum, opt->beltsz);
+  _update_word (checksum, opt->beltwrap);
+  _update_word (checksum, opt->cellbits);
+  _update_word (checksum, opt->checkbelt);
+  _update_word (checksum, opt->checkio);
+  _update_word (checksum, opt->compile);
+  _update_word (checksum, opt->emitbc);
+  _update_word (checksum, opt->emitll);
+  _update_word (checksum, opt->evalsteps);
+  _update_word (checksum, opt->lazybelt);
+  _update_word (checksum, opt->link);
+  _update_word (checksum, opt->mmodel);
+  _update_word (checksum, opt->olevel);
+  _update_word (checksum, opt->pic);
+  _update_word (checksum, opt->pie);
+  _update_word (checksum, opt->reloc);
+  _update_word (checksum, opt->sizelevel);
+  _update_word (checksum, opt->static_);
+  _update_word (checksum, opt->strict);
+  _update_word (checksum, n_filenames);
+
+  /*
+   * A profile in use counts as one more input
+   *
+   */
+  if (opt->profuse != NULL && !_update_file (checksum, opt->profuse, error))
+  {
+    g_checksum_free (checksum);
+    return NULL;
+  }
+
+  for (i = 0; i < n_filenames; i++)
+  if (!_update_file (checksum, filenames [i], error))
+  {
+    g_checksum_free (checksum);
+    return NULL;
+  }
+
+  key = g_strdup (g_checksum_get_string (checksum));
+        g_checksum_free (checksum);
+return key;
+}
+
+static void
+_count (const gchar* dir, const gchar* counter)
+{
+  gchar* path = g_build_filename (dir, CACHE_STATS, NULL);
+  GKeyFile* file = g_key_file_new ();
+  guint64 value;
+
+  /*
+   * Statistics are best effort: two compilers
+   * racing for this file may lose a count
+   *
+   */
+  g_mkdir_with_parents (dir, 0755);
+  g_key_file_load_from_file (file, path, G_KEY_FILE_NONE, NULL);
+  value = g_key_file_get_uint64 (file, CACHE_GROUP, counter, NULL);
+          g_key_file_set_uint64 (file, CACHE_GROUP, counter, value + 1);
+          g_key_file_save_to_file (file, path, NULL);
+          g_key_file_free (file);
+          g_free (path);
+}
+
+gboolean
+cache_fetch (const gchar* dir, const gchar* key, const gchar* output, GError** error)
+{
+  gchar* path = g_build_filename (dir, key, NULL);
+  GFile* source = g_file_new_for_path (path);
+  GFile* destination = g_file_new_for_commandline_arg (output);
+  GError* tmperr = NULL;
+  gboolean hit;
+
+  /*
+   * GIO clones the entry instead of copying its
+   * contents where the filesystem supports it
+   *
+   */
+  hit = g_file_copy (source, destination, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &tmperr);
+
+  if (hit)
+    g_utime (path, NULL);
+  else
+  if (g_error_matches (tmperr, G_IO_ERROR, G_IO_ERROR_NOT_FOUND))
+    g_clear_error (&tmperr);
+  else
+    g_propagate_error (error, tmperr);
+
+  _count (dir, hit ? "hits" : "misses");
+
+  g_object_unref (destination);
+  g_object_unref (source);
+  g_free (path);
+return hit;
+}
+
+static gint
+_compare (gconstpointer a, gconstpointer b)
+{
+  const Entry* entry1 = a;
+  const Entry* entry2 = b;
+return (entry1->mtime > entry2->mtime) - (entry1->mtime < entry2->mtime);
+}
+
+static gsize
+_xdigits (const gchar* name)
+{
+  gsize i;
+
+  for (i = 0; g_ascii_isxdigit (name [i]); i++);
+return i;
+}
+
+static gboolean
+_is_key (const gchar* name)
+{
+  gsize length = g_checksum_type_get_length (G_CHECKSUM_SHA256) * 2;
+return _xdigits (name) == length && name [length] == 0;
+}
+
+static gboolean
+_is_temp (const gchar* name)
+{
+  gsize length = g_checksum_type_get_length (G_CHECKSUM_SHA256) * 2;
+return _xdigits (name) == length && name [length] == '.'
+    && _xdigits (name + length + 1) == 8 && name [length + 9] == 0;
+}
+
+static GArray*
+_list (const gchar* dir, guint64* total)
+{
+  GArray* entries = g_array_new (FALSE, FALSE, sizeof (Entry));
+  GDir* handle = g_dir_open (dir, 0, NULL);
+  gint64 now = g_get_real_time () / G_USEC_PER_SEC;
+  const gchar* name;
+  gboolean temp;
+  GStatBuf st;
+
+  *total = 0;
+
+  if (handle != NULL)
+  {
+    while ((name = g_dir_read_name (handle)) != NULL)
+    {
+      if (!(temp = _is_temp (name)) && !_is_key (name))
+        continue;
+
+      gchar* path = g_build_filename (dir, name, NULL);
+
+      /*
+       * Entries still being stored take their room, but
+       * are not there yet to be evicted; abandoned ones
+       * are swept away
+       *
+       */
+      if (g_stat (path, &st) == 0)
+      {
+        if (!temp)
+        {
+          Entry entry = { g_strdup (name), st.st_size, st.st_mtime, };
+          g_array_append_val (entries, entry);
+          *total += entry.size;
+        }
+        else
+        if (st.st_mtime + CACHE_STALE > now)
+          *total += st.st_size;
+        else
+          g_unlink (path);
+      }
+
+      g_free (path);
+    }
+
+    g_dir_close (handle);
+  }
+return entries;
+}
+
+static void
+_free_entries (GArray* entries)
+{
+  guint i;
+
+  for (i = 0; i < entries->len; i++)
+    g_free (g_array_index (entries, Entry, i).name);
+    g_array_free (entries, TRUE);
+}
+
+static void
+_evict (const gchar* dir, guint64 limit)
+{
+  guint64 total;
+  GArray* entries = _list (dir, &total);
+  guint i;
+
+  g_array_sort (entries, _compare);
+
+  for (i = 0; i < entries->len && total > limit; i++)
+  {
+    Entry* entry = & g_array_index (entries, Entry, i);
+    gchar* path = g_build_filename (dir, entry->name, NULL);
+
+    if (g_unlink (path) == 0)
+      total -= entry->size;
+      g_free (path);
+  }
+
+  _free_entries (entries);
+}
+
+void
+cache_store (const gchar* dir, const gchar* key, const gchar* output, guint64 limit, GError** error)
+{
+  gchar* path = g_build_filename (dir, key, NULL);
+  gchar* temp = g_strdup_printf ("%s.%08x", path, g_random_int ());
+  GFile* source = g_file_new_for_commandline_arg (output);
+  GFile* destination = g_file_new_for_path (temp);
+  GError* tmperr = NULL;
+
+  if (g_mkdir_with_parents (dir, 0755) < 0)
+  {
+    g_object_unref (destination);
+    g_object_unref (source);
+    g_free (temp);
+    g_free (path);
+    THROW_ERRNO ("Can not create cache directory", dir);
+  }
+
+  /*
+   * Entries are written aside and renamed into place, so
+   * a concurrent fetch never sees a half written one
+   *
+   */
+  g_file_copy (source, destination, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &tmperr);
+
+  if (G_UNLIKELY (tmperr != NULL))
+  {
+    g_propagate_error (error, tmperr);
+    g_unlink (temp);
+  }
+  else
+  if (g_rename (temp, path) < 0)
+  {
+    int errsv = errno;
+    g_set_error (error, G_IO_ERROR, g_io_error_from_errno (errsv), "%s: %s", path, g_strerror (errsv));
+    g_unlink (temp);
+  }
+  else
+    _evict (dir, limit);
+
+  g_object_unref (destination);
+  g_object_unref (source);
+  g_free (temp);
+  g_free (path);
+}
+
+void
+cache_stats (const gchar* dir, guint64 limit)
+{
+  gchar* path = g_build_filename (dir, CACHE_STATS, NULL);
+  GKeyFile* file = g_key_file_new ();
+  guint64 hits, misses, total;
+  GArray* entries = _list (dir, &total);
+
+  g_key_file_load_from_file (file, path, G_KEY_FILE_NONE, NULL);
+  hits = g_key_file_get_uint64 (file, CACHE_GROUP, "hits", NULL);
+  misses = g_key_file_get_uint64 (file, CACHE_GROUP, "misses", NULL);
+
+  g_print ("cache directory: %s\n", dir);
+  g_print ("entries: %u\n", entries->len);
+  g_print ("size: %" G_GUINT64_FORMAT " (limit %" G_GUINT64_FORMAT ")\n", total, limit);
+  g_print ("hits: %" G_GUINT64_FORMAT "\n", hits);
+  g_print ("misses: %" G_GUINT64_FORMAT "\n", misses);
+
+  _free_entries (entries);
+  g_key_file_free (file);
+  g_free (path);
+}
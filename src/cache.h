@@ -0,0 +1,36 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_CACHE__
+#define __BFC_CACHE__ 1
+#include <bfc.h>
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+G_GNUC_INTERNAL gchar*
+cache_key (BfcOptions* opt, const gchar* arch, const gchar* tune, const gchar* features, gchar** filenames, guint n_filenames, GError** error);
+G_GNUC_INTERNAL gboolean
+cache_fetch (const gchar* dir, const gchar* key, const gchar* output, GError** error);
+G_GNUC_INTERNAL void
+cache_store (const gchar* dir, const gchar* key, const gchar* output, guint64 limit, GError** error);
+G_GNUC_INTERNAL void
+cache_stats (const gchar* dir, guint64 limit);
+
+G_END_DECLS
+
+#endif // __BFC_CACHE__
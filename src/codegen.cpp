@@ -17,17 +17,31 @@
  */
 #include <config.h>
 #include <codegen.hpp>
+#include <llvm/Analysis/ModuleSummaryAnalysis.h>
+#include <llvm/Analysis/ProfileSummaryInfo.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InlineAsm.h>
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/MDBuilder.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/MC/SubtargetFeature.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/ProfileData/InstrProf.h>
+#include <llvm/ProfileData/ProfileCommon.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Target/TargetMachine.h>
-#include <llvm/Transforms/InstCombine/InstCombine.h>
-#include <llvm/Transforms/Scalar.h>
-#include <llvm/Transforms/Scalar/DCE.h>
-#include <llvm/Transforms/Scalar/GVN.h>
-#include <llvm/Transforms/Utils.h>
+#include <llvm/Transforms/IPO/HotColdSplitting.h>
+#include <interp.hpp>
+#include <link.hpp>
+#include <map>
+#include <program.hpp>
+#include <runtime.hpp>
 #include <stream.hpp>
+#include <sys/mman.h>
 using namespace llvm;
 
 G_DEFINE_QUARK (bfc-codegen-error-quark, bfc_codegen_error);
@@ -35,10 +49,43 @@ G_DEFINE_QUARK (bfc-codegen-error-quark, bfc_codegen_error);
 #define BFC_CODEGEN_ERROR_FAILED (0)
 static const char* NONAME = "";
 
+/*
+ * Lazy belts are mapped in multiples of GUARDSZ (the largest
+ * common page size), with as much inaccessible space on either
+ * side; those spanning at least HUGESZ are backed by huge pages
+ * when the system allows it
+ *
+ */
+static const gsize GUARDSZ = 65536;
+static const gsize HUGESZ = 2 * 1024 * 1024;
+
+/*
+ * Profiles (see --profile-generate) are arrays of 64 bit words
+ * in the target's byte order: a header (magic and version, the
+ * program's fingerprint and its loop count) followed by a record
+ * per loop (the index of its op_open, and how many times it was
+ * reached, entered and jumped back into)
+ *
+ */
+static const guint64 PROFILE_MAGIC = 0x50434642 | (G_GUINT64_CONSTANT (1) << 32);
+static const gsize PROFILE_HEADER = 3;
+static const gsize PROFILE_RECORD = 4;
+
+struct BfcCounts
+{
+  guint64 reach;
+  guint64 enter;
+  guint64 back;
+};
+
 struct BfcIterator
 {
-  BasicBlock* start;
+  BasicBlock* body;
   BasicBlock* end;
+  PHINode* cursor;
+  PHINode* exit;
+  gboolean balanced;
+  gint64 lo, hi;
 
   inline static BfcIterator* alloc ()
   {
@@ -51,6 +98,27 @@ struct BfcIterator
   }
 };
 
+/*
+ * Shared between the interpreter and the compiling thread in
+ * tiered execution (see BfcState::tier): hot reports queue the
+ * loop to be compiled (see BfcState::compile)
+ *
+ */
+struct BfcTier
+{
+  BfcOptions* opt;
+  Bfc::Program* program;
+  orc::LLJIT* jit;
+  Bfc::Interpreter* interpreter;
+  GThreadPool* pool;
+
+  static void hot (gsize open, gpointer pthis)
+  {
+    auto self = (BfcTier*) pthis;
+    g_thread_pool_push (self->pool, GSIZE_TO_POINTER (open + 1), nullptr);
+  }
+};
+
 class BfcState
 {
 public:
@@ -61,54 +129,393 @@ public:
     builder = std::unique_ptr<IRBuilder<>> (new IRBuilder<> (*context));
   }
 
-  inline void prologue (BfcOptions* opt, Module* module, GError** error)
+  /*
+   * Builds a constant array of cells (of unit type)
+   *
+   */
+  template<typename T>
+  static inline Constant* cellarray (LLVMContext& context, const std::vector<guint64>& cells)
   {
-    BasicBlock* block;
-    Value* zero = nullptr;
-    Type* void_ = nullptr;
+    auto data = std::vector<T> (cells.begin (), cells.end ());
+    return ConstantDataArray::get (context, data);
+  }
 
-    auto beltsz = opt->beltsz;
-    auto unitsz = sizeof (char);
-    auto link = GlobalValue::ExternalLinkage;
+  /*
+   * Sets up the types (and the exit blocks) every function
+   * generate works in relies upon
+   *
+   */
+  inline void setup (BfcOptions* opt, Bfc::Program* program, Module* module)
+  {
+    auto unitsz = opt->cellbits / 8;
     auto machine = (TargetMachine*) opt->machine;
+    auto layout = machine->createDataLayout ();
 
+    module->setDataLayout (layout);
+    offsetty = layout.getIntPtrType (*context);
     unit = Type::getIntNTy (*context, unitsz * 8);
 
     ioargs [0] = Type::getInt32Ty (*context);
     ioargs [1] = Type::getInt8PtrTy (*context);
-    ioargs [2] = Type::getInt32Ty (*context);
+    ioargs [2] = offsetty;
     ioerr = BasicBlock::Create (*context);
+    ooberr = BasicBlock::Create (*context);
+    beltsz = program->beltsz;
+    indexed = opt->beltwrap || opt->checkbelt;
     ioret = ioargs [0];
+    scanners.clear ();
+    counters = nullptr;
+    loops.clear ();
+    profile.clear ();
+  }
+
+  /*
+   * Fingerprints the ops, so profiles recorded for other
+   * sources (or with other simplification or evaluation
+   * options) are refused rather than misapplied
+   *
+   */
+  static guint64 fingerprint (const Bfc::Program* program)
+  {
+    guint64 hash = G_GUINT64_CONSTANT (14695981039346656037);
+
+    for (auto& op : program->ops)
+    {
+      guint64 words [] = { (guint64) op.code, (guint64) op.offset, (guint64) op.value, (guint64) op.jump, (guint64) op.source, };
+
+      for (auto word : words)
+      {
+        hash ^= word;
+        hash *= G_GUINT64_CONSTANT (1099511628211);
+      }
+    }
+  return hash;
+  }
+
+  /*
+   * Sets up a record of counters per loop (see count), which
+   * main writes out before returning, or loads the counts weigh
+   * works with from a profile
+   *
+   */
+  inline void profiling (BfcOptions* opt, Bfc::Program* program, Module* module, GError** error)
+  {
+    auto& ops = program->ops;
+    auto hash = fingerprint (program);
+
+    if (opt->profgen != nullptr)
+    {
+      auto words = std::vector<guint64> { PROFILE_MAGIC, hash, 0, };
+      auto link = GlobalValue::PrivateLinkage;
+
+      for (gsize i = 0; i < ops.size (); ++i)
+      if (ops [i].code == Bfc::op_open)
+      {
+        loops.emplace (i, loops.size ());
+        words.insert (words.end (), { (guint64) i, 0, 0, 0, });
+      }
+
+      words [2] = loops.size ();
+
+      auto data = ConstantDataArray::get (*context, words);
+      counters = new GlobalVariable (*module, data->getType (), false, link, data, "bfc.profile");
+        counters->setAlignment (MaybeAlign (8));
+    }
+
+    if (opt->profuse != nullptr)
+    {
+      auto tmperr = (GError*) nullptr;
+      auto contents = (gchar*) nullptr;
+      auto length = (gsize) 0;
+
+      if (!g_file_get_contents (opt->profuse, &contents, &length, &tmperr))
+      {
+        g_propagate_error (error, tmperr);
+        return;
+      }
+
+      auto words = (const guint64*) contents;
+      auto n_words = length / sizeof (guint64);
+      auto valid = length % sizeof (guint64) == 0
+                && n_words >= PROFILE_HEADER
+                && words [0] == PROFILE_MAGIC
+                && (n_words - PROFILE_HEADER) / PROFILE_RECORD == words [2]
+                && (n_words - PROFILE_HEADER) % PROFILE_RECORD == 0;
+
+      if (valid && words [1] != hash)
+      {
+        g_set_error
+        (error,
+         BFC_CODEGEN_ERROR,
+         BFC_CODEGEN_ERROR_FAILED,
+         "Profile %s does not match this program (or was recorded with other options)",
+         opt->profuse);
+        g_free (contents);
+        return;
+      }
+
+      for (gsize i = PROFILE_HEADER; valid && i < n_words; i += PROFILE_RECORD)
+      {
+        auto open = words [i];
+        auto counts = BfcCounts { words [i + 1], words [i + 2], words [i + 3], };
 
-    readty = FunctionType::get (ioret, ioargs, false);
+        valid = open < ops.size ()
+             && ops [open].code == Bfc::op_open
+             && counts.enter <= counts.reach;
+        profile [open] = counts;
+      }
+
+      g_free (contents);
+
+      if (!valid)
+      {
+        g_set_error
+        (error,
+         BFC_CODEGEN_ERROR,
+         BFC_CODEGEN_ERROR_FAILED,
+         "%s is not a valid profile",
+         opt->profuse);
+        return;
+      }
+    }
+  }
+
+  /*
+   * Builds bfc.record, which writes the loop counters out to
+   * the profile (quietly giving up if it can not be created)
+   *
+   */
+  Function* recorder (BfcOptions* opt, Module* module)
+  {
+    auto link = GlobalValue::PrivateLinkage;
+    auto intty = Type::getInt32Ty (*context);
+    auto layout = module->getDataLayout ();
+    auto size = layout.getTypeAllocSize (counters->getValueType ());
+    auto creatty = FunctionType::get (ioret, { ioargs [1], intty }, false);
+    auto closety = FunctionType::get (ioret, { ioret }, false);
+    auto creat = module->getOrInsertFunction ("creat", creatty);
+    auto close = module->getOrInsertFunction ("close", closety);
+    auto func = Function::Create (FunctionType::get (builder->getVoidTy (), false), link, "bfc.record", module);
+      func->addFnAttr (Attribute::Cold);
+      func->addFnAttr (Attribute::NoInline);
+
+    auto entry = BasicBlock::Create (*context, NONAME, func);
+    auto body = BasicBlock::Create (*context, NONAME, func);
+    auto done = BasicBlock::Create (*context, NONAME, func);
+    IRBuilder<> b (entry);
+    auto zero = ConstantInt::get (ioret, 0, true);
+
+    auto path = b.CreateGlobalStringPtr (opt->profgen, "bfc.profile.path", 0, module);
+    auto fd = b.CreateCall (creat, { path, ConstantInt::get (intty, 0644, false) });
+    b.CreateCondBr (b.CreateICmpSLT (fd, zero), done, body);
+
+    b.SetInsertPoint (body);
+    b.CreateCall (writety, write, { fd, b.CreateBitCast (counters, ioargs [1]), ConstantInt::get (offsetty, size, false) });
+    b.CreateCall (close, { fd });
+    b.CreateBr (done);
+
+    b.SetInsertPoint (done);
+    b.CreateRetVoid ();
+  return func;
+  }
+
+  /*
+   * Counts one more time the loop opened at ops [open] was
+   * reached, entered or jumped back into (which, from 0 to 2),
+   * or, given a (the cell is zero) test, one more time unless
+   * it holds; counters are updated without branching
+   *
+   */
+  inline void count (gsize open, guint which, Value* test)
+  {
+    auto found = loops.find (open);
+
+    if (counters != nullptr && found != loops.end ())
+    {
+      auto i64 = builder->getInt64Ty ();
+      auto index = PROFILE_HEADER + PROFILE_RECORD * found->second + 1 + which;
+      auto ptr = builder->CreateConstInBoundsGEP2_64 (counters->getValueType (), counters, 0, index);
+      auto step = (test == nullptr)
+        ? (Value*) ConstantInt::get (i64, 1, false)
+        : builder->CreateZExt (builder->CreateNot (test), i64);
+
+      builder->CreateStore (builder->CreateAdd (builder->CreateLoad (i64, ptr), step), ptr);
+    }
+  }
+
+  /*
+   * Profiled weights of the (the cell is zero) test opening the
+   * loop at ops [open] or, if latch, closing it: those on the
+   * latch are also what loop passes estimate trip counts upon
+   *
+   */
+  inline MDNode* weigh (gsize open, gboolean latch)
+  {
+    auto found = profile.find (open);
+
+    if (found == profile.end ())
+      return nullptr;
+
+    auto& counts = found->second;
+    auto leave = latch ? counts.enter : counts.reach - counts.enter;
+    auto stay = latch ? counts.back : counts.enter;
+    auto shift = 0;
+
+    while ((MAX (leave, stay) >> shift) >= G_MAXUINT32)
+      ++shift;
+  return MDBuilder (*context).createBranchWeights ((guint32) (leave >> shift) + 1, (guint32) (stay >> shift) + 1);
+  }
+
+  /*
+   * Attaches a summary of the profile to the module, so hot
+   * and cold code can be told apart (by inlining and hot/cold
+   * splitting, for instance). Main runs once, which the summary
+   * would deem cold (so it would be shrunk as a whole), so it is
+   * rather entered just often enough not to be
+   *
+   */
+  inline void summarize (Module* module)
+  {
+    auto counts = std::vector<uint64_t> { 1, };
+
+    for (auto& entry : profile)
+    {
+      counts.push_back (entry.second.reach);
+      counts.push_back (entry.second.enter + entry.second.back);
+    }
+
+    for (guint pass = 0; pass < 2; ++pass)
+    {
+      auto record = InstrProfRecord (counts);
+      auto builder = InstrProfSummaryBuilder (ProfileSummaryBuilder::DefaultCutoffs.vec ());
+        builder.addRecord (record);
+      auto summary = builder.getSummary ();
+
+      if (pass == 0)
+        counts [0] = 1 + ProfileSummaryBuilder::getColdCountThreshold (summary->getDetailedSummary ());
+      else
+      {
+        main->setEntryCount (counts [0]);
+        module->setProfileSummary (summary->getMD (*context), ProfileSummary::PSK_Instr);
+      }
+    }
+  }
+
+  inline void prologue (BfcOptions* opt, Bfc::Program* program, Module* module, GError** error)
+  {
+    BasicBlock* block;
+
+    auto unitsz = opt->cellbits / 8;
+    auto link = GlobalValue::ExternalLinkage;
+    auto machine = (TargetMachine*) opt->machine;
+
+    setup (opt, program, module);
+
+    readty = FunctionType::get (offsetty, ioargs, false);
     read = Function::Create (readty, link, "read", module);
-    writety = FunctionType::get (ioret, ioargs, false);
+    writety = FunctionType::get (offsetty, ioargs, false);
     write = Function::Create (writety, link, "write", module);
+    runtime (module);
 
     mainty = FunctionType::get (ioret, false);
     main = Function::Create (mainty, link, "main", module);
     block = BasicBlock::Create (*context, NONAME, main);
     builder->SetInsertPoint (block);
 
-    cursorty = Type::getIntNTy (*context, 32);
-    cursor = builder->CreateAlloca (cursorty, nullptr, "cursor");
+    auto tmperr = (GError*) nullptr;
+
+    profiling (opt, program, module, &tmperr);
+
+    if (G_UNLIKELY (tmperr != nullptr))
+    {
+      g_propagate_error (error, tmperr);
+      return;
+    }
+
+    if (opt->profuse != nullptr)
+      summarize (module);
+
+    if (opt->lazybelt && !machine->getTargetTriple ().isOSLinux ())
     {
-      auto size = ConstantInt::get (cursorty, unitsz * beltsz, false);
-      auto inst = CallInst::CreateMalloc (block, cursorty, unit, size, nullptr, nullptr);
-      belt = builder->Insert (inst, "belt");
+      g_set_error
+      (error,
+       BFC_CODEGEN_ERROR,
+       BFC_CODEGEN_ERROR_FAILED,
+       "Lazy belts are only supported on Linux targets");
+      return;
     }
 
-    builder->CreateStore (ConstantInt::get (cursorty, 0, false), cursor);
+    allocate (opt, module);
+
+    /*
+     * Resume from the state reached by compile-time evaluation
+     * (see Bfc::Program::evaluate)
+     *
+     */
+    auto& initial = program->initial;
+
+    if (!initial.cells.empty ())
+    {
+      auto link = GlobalValue::PrivateLinkage;
+      auto size = unitsz * initial.cells.size ();
+      Constant* data;
 
-    zero = ConstantInt::get (Type::getInt8Ty (*context), 0, false);
-    builder->CreateMemSet (this->belt, zero, unitsz * beltsz, MaybeAlign (unitsz));
+      switch (unit->getIntegerBitWidth ())
+      {
+        case 8: data = cellarray<guint8> (*context, initial.cells); break;
+        case 16: data = cellarray<guint16> (*context, initial.cells); break;
+        case 32: data = cellarray<guint32> (*context, initial.cells); break;
+        default: data = cellarray<guint64> (*context, initial.cells); break;
+      }
+
+      auto global = new GlobalVariable (*module, data->getType (), true, link, data, "cells");
+        global->setUnnamedAddr (GlobalValue::UnnamedAddr::Global);
+        global->setAlignment (MaybeAlign (unitsz));
+      builder->CreateMemCpy (belt, MaybeAlign (unitsz), global, MaybeAlign (unitsz), size);
+    }
+
+    if (indexed)
+      cursor = ConstantInt::get (offsetty, initial.cursor, false);
+    else
+    {
+      auto offset = ConstantInt::get (offsetty, initial.cursor, false);
+      cursor = (initial.cursor == 0) ? belt : builder->CreateInBoundsGEP (unit, belt, offset);
+    }
+
+    if (!initial.output.empty ())
+    {
+      auto length = initial.output.size ();
+      auto string = builder->CreateGlobalStringPtr (initial.output, "output", 0, module);
+      Value* args [] =
+      {
+        builder->CreateBitCast (string, ioargs [1]),
+        ConstantInt::get (offsetty, length, false),
+      };
+
+      checkio (opt, builder->CreateCall (puts, args));
+    }
   }
 
   inline void epilogue (BfcOptions* opt, Module* module, GError** error)
   {
-    auto block = builder->GetInsertBlock ();
+    auto record = (counters == nullptr) ? nullptr : recorder (opt, module);
+
+    /*
+     * Counts are written out however main returns, so a
+     * profile is recorded even for failed runs
+     *
+     */
+  #define RECORD() \
+    G_STMT_START { \
+      if (record != nullptr) \
+        builder->CreateCall (record); \
+    } G_STMT_END
+
+    checkio (opt, builder->CreateCall (flush));
+    release (opt);
+    RECORD ();
 
-    builder->Insert (CallInst::CreateFree (belt, block));
+    auto block = builder->GetInsertBlock ();
     builder->CreateRet (ConstantInt::get (ioret, 0, false));
 
     if (opt->checkio)
@@ -117,350 +524,1301 @@ public:
       auto list = &parent->getBasicBlockList ();
         list->push_back (ioerr);
 
+      /*
+       * Whatever was buffered before the failure is still
+       * written out (a failed flush leaves the buffer empty)
+       *
+       */
       builder->SetInsertPoint (ioerr);
-      builder->Insert (CallInst::CreateFree (belt, ioerr));
+      builder->CreateCall (flush);
+      release (opt);
+      RECORD ();
       builder->CreateRet (ConstantInt::get (ioret, -1, true));
     }
+
+    if (!opt->checkbelt || ooberr->hasNPredecessors (0))
+      delete ooberr;
+    else
+    {
+      auto parent = block->getParent ();
+      auto list = &parent->getBasicBlockList ();
+        list->push_back (ooberr);
+
+      builder->SetInsertPoint (ooberr);
+      builder->CreateCall (flush);
+      release (opt);
+      RECORD ();
+      builder->CreateRet (ConstantInt::get (ioret, -2, true));
+    }
+  #undef RECORD
   }
 
-  inline void generate (BfcOptions* opt, BfcStream* input, GError** error)
+  /*
+   * Builds the loop opened at ops [open] into a function of its
+   * own, named bfc.loop.<open>, for tiered execution: its calling
+   * convention is that of Bfc::Interpreter::Native. The belt is
+   * the interpreter's, and so is the I/O runtime (see import)
+   *
+   */
+  inline void loop (BfcOptions* opt, Bfc::Program* program, gsize open, Module* module, GError** error)
   {
-    auto stream = input->istream;
-    GQueue iterators = G_QUEUE_INIT;
-    GError* tmperr = NULL;
-    gchar* line = NULL;
-    gsize length = 0;
-    gsize i;
+    setup (opt, program, module);
+    import (module);
 
-    guint n_line = 1;
-    guint n_column = 1;
+    auto link = GlobalValue::ExternalLinkage;
+    auto ptrty = PointerType::getUnqual (unit);
+    auto slotty = (indexed) ? offsetty : (Type*) ptrty;
+    auto functy = FunctionType::get (ioret, { ptrty, PointerType::getUnqual (slotty) }, false);
+    auto name = g_strdup_printf ("bfc.loop.%" G_GSIZE_FORMAT, open);
+    auto func = Function::Create (functy, link, name, module);
+    auto slot = func->getArg (1);
 
-    guint in_forwards = 0;
-    guint in_backwards = 0;
-    guint in_inc = 0;
-    guint in_dec = 0;
+    g_free (name);
+    builder->SetInsertPoint (BasicBlock::Create (*context, NONAME, func));
 
-  #define CLEANUP(...) \
-    G_STMT_START { \
-      g_queue_clear_full (&iterators, BfcIterator::free); \
-      __VA_ARGS__; \
-    } G_STMT_END
-  #define CURSOR_GET() \
-    (G_GNUC_EXTENSION ({ \
-      builder->CreateLoad (cursorty, cursor); \
-    }))
-  #define CURSOR_SET(value) \
+    belt = func->getArg (0);
+    cursor = builder->CreateLoad (slotty, slot);
+
+    generate (opt, program, open, program->ops [open].jump + 1, error);
+
+    builder->CreateStore (cursor, slot);
+    builder->CreateRet (ConstantInt::get (ioret, 0, false));
+
+    /*
+     * Unlike main, the loop leaves flushing (and the belt) to
+     * the interpreter on failure
+     *
+     */
+    if (!opt->checkio)
+      delete ioerr;
+    else
+    {
+      func->getBasicBlockList ().push_back (ioerr);
+      builder->SetInsertPoint (ioerr);
+      builder->CreateRet (ConstantInt::get (ioret, -1, true));
+    }
+
+    if (!opt->checkbelt || ooberr->hasNPredecessors (0))
+      delete ooberr;
+    else
+    {
+      func->getBasicBlockList ().push_back (ooberr);
+      builder->SetInsertPoint (ooberr);
+      builder->CreateRet (ConstantInt::get (ioret, -2, true));
+    }
+  }
+
+  /*
+   * Allocates the belt, padded by CHUNKSZ bytes on both ends,
+   * and points belt to its first cell. A lazy belt is instead
+   * reserved with mmap between two inaccessible guard areas: its
+   * pages are zero-filled by the kernel on first touch (so huge
+   * belts cost nothing until used), and running off either end
+   * faults instead of silently corrupting memory. Executables
+   * bring no allocator along (see freestanding), so theirs is
+   * static otherwise
+   *
+   */
+  inline void allocate (BfcOptions* opt, Module* module)
+  {
+    auto unitsz = unit->getIntegerBitWidth () / 8;
+    auto bytes = unitsz * beltsz + 2 * CHUNKSZ;
+    auto pad = ConstantInt::get (offsetty, CHUNKSZ / unitsz, false);
+
+    if (!opt->lazybelt && opt->link)
+    {
+      auto link = GlobalValue::PrivateLinkage;
+      auto beltty = ArrayType::get (builder->getInt8Ty (), bytes);
+      auto zero = ConstantAggregateZero::get (beltty);
+      auto global = new GlobalVariable (*module, beltty, false, link, zero, "bfc.belt");
+        global->setAlignment (MaybeAlign (CHUNKSZ));
+
+      base = builder->CreateBitCast (global, PointerType::getUnqual (unit));
+    }
+    else
+    if (!opt->lazybelt)
+    {
+      auto block = builder->GetInsertBlock ();
+      auto size = ConstantInt::get (offsetty, bytes, false);
+      auto inst = CallInst::CreateMalloc (block, offsetty, unit, size, nullptr, nullptr);
+
+      base = builder->Insert (inst);
+      builder->CreateMemSet (base, builder->getInt8 (0), bytes, MaybeAlign (unitsz));
+    }
+    else
+    {
+      /*
+       * Flag values are the host's, which match those of
+       * every common Linux target
+       *
+       */
+      auto intty = Type::getInt32Ty (*context);
+      auto ptrty = ioargs [1];
+      auto mmapty = FunctionType::get (ptrty, { ptrty, offsetty, intty, intty, intty, offsetty }, false);
+      auto mprotectty = FunctionType::get (intty, { ptrty, offsetty, intty }, false);
+      auto mmap = module->getOrInsertFunction ("mmap", mmapty);
+      auto mprotect = module->getOrInsertFunction ("mprotect", mprotectty);
+      auto inner = (bytes + GUARDSZ - 1) & ~(gsize) (GUARDSZ - 1);
+      auto parent = builder->GetInsertBlock ()->getParent ();
+      auto nomem = BasicBlock::Create (*context, NONAME, parent);
+      auto then = BasicBlock::Create (*context, NONAME, parent);
+      auto done = BasicBlock::Create (*context, NONAME, parent);
+
+      mapsz = inner + 2 * GUARDSZ;
+
+      Value* args [] =
+      {
+        ConstantPointerNull::get ((PointerType*) ptrty),
+        ConstantInt::get (offsetty, mapsz, false),
+        ConstantInt::get (intty, PROT_NONE, false),
+        ConstantInt::get (intty, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, false),
+        ConstantInt::get (intty, -1, true),
+        ConstantInt::get (offsetty, 0, false),
+      };
+
+      mapping = builder->CreateCall (mmap, args);
+      auto addr = builder->CreatePtrToInt (mapping, offsetty);
+      auto failed = builder->CreateICmpEQ (addr, ConstantInt::get (offsetty, -1, true));
+      builder->CreateCondBr (failed, nomem, then);
+
+      builder->SetInsertPoint (then);
+      auto start = builder->CreateInBoundsGEP (builder->getInt8Ty (), mapping, ConstantInt::get (offsetty, GUARDSZ, false));
+      auto size = ConstantInt::get (offsetty, inner, false);
+      auto status = builder->CreateCall (mprotect, { start, size, ConstantInt::get (intty, PROT_READ | PROT_WRITE, false) });
+      builder->CreateCondBr (builder->CreateICmpNE (status, ConstantInt::get (intty, 0, false)), nomem, done);
+
+      builder->SetInsertPoint (nomem);
+      builder->CreateRet (ConstantInt::get (ioret, -1, true));
+
+      builder->SetInsertPoint (done);
+#ifdef MADV_HUGEPAGE
+      if (inner >= HUGESZ)
+      {
+        auto madvisety = FunctionType::get (intty, { ptrty, offsetty, intty }, false);
+        auto madvise = module->getOrInsertFunction ("madvise", madvisety);
+
+        builder->CreateCall (madvise, { start, size, ConstantInt::get (intty, MADV_HUGEPAGE, false) });
+      }
+#endif // MADV_HUGEPAGE
+      base = builder->CreateBitCast (start, PointerType::getUnqual (unit));
+    }
+
+    belt = builder->CreateInBoundsGEP (unit, base, pad, "belt");
+  }
+
+  /*
+   * Gives the belt back (at the current insertion point)
+   *
+   */
+  inline void release (BfcOptions* opt)
+  {
+    auto block = builder->GetInsertBlock ();
+
+    if (!opt->lazybelt && opt->link)
+      return;
+    else
+    if (!opt->lazybelt)
+      builder->Insert (CallInst::CreateFree (base, block));
+    else
+    {
+      auto module = block->getModule ();
+      auto intty = Type::getInt32Ty (*context);
+      auto munmapty = FunctionType::get (intty, { ioargs [1], offsetty }, false);
+      auto munmap = module->getOrInsertFunction ("munmap", munmapty);
+
+      builder->CreateCall (munmap, { mapping, ConstantInt::get (offsetty, mapsz, false) });
+    }
+  }
+
+  /*
+   * Tests whether cells [lo, hi] (relative to the cursor) all
+   * lie within the belt
+   *
+   */
+  inline Value* inbelt (gint64 lo, gint64 hi)
+  {
+    if ((guint64) (hi - lo) >= beltsz)
+      return builder->getFalse ();
+    else
+    {
+      auto first = builder->CreateAdd (cursor, ConstantInt::get (offsetty, lo, true));
+      auto room = ConstantInt::get (offsetty, beltsz - (hi - lo), false);
+      return builder->CreateICmpULT (first, room);
+    }
+  }
+
+  /*
+   * Leaves through the ooberr block unless cells [lo, hi]
+   * (relative to the cursor) all lie within the belt
+   *
+   */
+  inline void checkbelt (gint64 lo, gint64 hi)
+  {
+    auto parent = builder->GetInsertBlock ()->getParent ();
+    auto then = BasicBlock::Create (*context, NONAME, parent);
+    auto weights = MDBuilder (*context).createBranchWeights (1 << 20, 1);
+
+    builder->CreateCondBr (inbelt (lo, hi), then, ooberr, weights);
+    builder->SetInsertPoint (then);
+  }
+
+  /*
+   * Branches to the ioerr block when status (as returned by
+   * the runtime routines) is negative and I/O errors are checked
+   *
+   */
+  inline void checkio (BfcOptions* opt, Value* status)
+  {
+    if (opt->checkio)
+    {
+      auto block = builder->GetInsertBlock ();
+      auto parent = block->getParent ();
+      auto then = BasicBlock::Create (*context, NONAME, parent);
+      auto zero = ConstantInt::get (status->getType (), 0, false);
+      auto weights = MDBuilder (*context).createBranchWeights (1, 1 << 20);
+
+      builder->CreateCondBr (builder->CreateICmpSLT (status, zero), ioerr, then, weights);
+      builder->SetInsertPoint (then);
+    }
+  }
+
+  /*
+   * Appends a byte to the output buffer, calling the runtime
+   * only to flush it when it is full
+   *
+   */
+  inline void putbyte (BfcOptions* opt, Value* value)
+  {
+    auto entry = builder->GetInsertBlock ();
+    auto parent = entry->getParent ();
+    auto slow = BasicBlock::Create (*context, NONAME, parent);
+    auto fast = BasicBlock::Create (*context, NONAME, parent);
+    auto bufty = outbuf->getValueType ();
+    auto zero = ConstantInt::get (offsetty, 0, false);
+    auto full = ConstantInt::get (offsetty, BUFFERSZ, false);
+    auto weights = MDBuilder (*context).createBranchWeights (1, 1 << 10);
+
+    value = builder->CreateZExtOrTrunc (value, builder->getInt8Ty ());
+    auto len = builder->CreateLoad (offsetty, outlen);
+    builder->CreateCondBr (builder->CreateICmpUGE (len, full), slow, fast, weights);
+
+    builder->SetInsertPoint (slow);
+    checkio (opt, builder->CreateCall (flush));
+    builder->CreateBr (fast);
+    auto flushed = builder->GetInsertBlock ();
+
+    builder->SetInsertPoint (fast);
+    auto at = builder->CreatePHI (offsetty, 2);
+      at->addIncoming (len, entry);
+      at->addIncoming (zero, flushed);
+    builder->CreateStore (value, builder->CreateInBoundsGEP (bufty, outbuf, { zero, at }));
+    builder->CreateStore (builder->CreateAdd (at, ConstantInt::get (offsetty, 1, false)), outlen);
+  }
+
+  /*
+   * Appends length bytes from ptr to the output buffer, which
+   * is copied in place when there is room for them and handed
+   * to bfc.puts otherwise
+   *
+   */
+  inline void putspan (BfcOptions* opt, Value* ptr, gsize length)
+  {
+    auto size = ConstantInt::get (offsetty, length, false);
+    ptr = builder->CreateBitCast (ptr, ioargs [1]);
+
+    if (length > BUFFERSZ)
+      checkio (opt, builder->CreateCall (puts, { ptr, size }));
+    else
+    {
+      auto parent = builder->GetInsertBlock ()->getParent ();
+      auto slow = BasicBlock::Create (*context, NONAME, parent);
+      auto fast = BasicBlock::Create (*context, NONAME, parent);
+      auto done = BasicBlock::Create (*context, NONAME, parent);
+      auto bufty = outbuf->getValueType ();
+      auto zero = ConstantInt::get (offsetty, 0, false);
+      auto room = ConstantInt::get (offsetty, BUFFERSZ - length, false);
+      auto weights = MDBuilder (*context).createBranchWeights (1 << 10, 1);
+
+      auto len = builder->CreateLoad (offsetty, outlen);
+      builder->CreateCondBr (builder->CreateICmpULE (len, room), fast, slow, weights);
+
+      builder->SetInsertPoint (fast);
+      auto dest = builder->CreateInBoundsGEP (bufty, outbuf, { zero, len });
+      builder->CreateMemCpy (dest, MaybeAlign (1), ptr, MaybeAlign (1), size);
+      builder->CreateStore (builder->CreateAdd (len, size), outlen);
+      builder->CreateBr (done);
+
+      builder->SetInsertPoint (slow);
+      checkio (opt, builder->CreateCall (puts, { ptr, size }));
+      builder->CreateBr (done);
+
+      builder->SetInsertPoint (done);
+    }
+  }
+
+  /*
+   * Emits the I/O runtime into the module: output is gathered
+   * in a buffer flushed once it fills up, before reading input
+   * and at exit, and input is read ahead in blocks. Generate
+   * emits the fast paths (the byte fits in or is left in the
+   * buffer) inline, so these routines only run to refill or to
+   * flush a buffer; a negative return means a failed read or
+   * write
+   *
+   */
+  inline void runtime (Module* module)
+  {
+    auto link = GlobalValue::InternalLinkage;
+    auto bytety = Type::getInt8Ty (*context);
+    auto bufty = ArrayType::get (bytety, BUFFERSZ);
+    auto empty = ConstantAggregateZero::get (bufty);
+    auto zero = ConstantInt::get (offsetty, 0, false);
+    auto size = ConstantInt::get (offsetty, BUFFERSZ, false);
+    auto okay = ConstantInt::get (ioret, 0, false);
+    auto failed = ConstantInt::get (ioret, -1, true);
+    IRBuilder<> b (*context);
+
+    inbuf = new GlobalVariable (*module, bufty, false, link, empty, "bfc.in");
+    inlen = new GlobalVariable (*module, offsetty, false, link, zero, "bfc.inlen");
+    inpos = new GlobalVariable (*module, offsetty, false, link, zero, "bfc.inpos");
+    outbuf = new GlobalVariable (*module, bufty, false, link, empty, "bfc.out");
+    outlen = new GlobalVariable (*module, offsetty, false, link, zero, "bfc.outlen");
+
+    auto inptr = ConstantExpr::getInBoundsGetElementPtr (bufty, inbuf, ArrayRef<Constant*> ({ zero, zero }));
+    auto outptr = ConstantExpr::getInBoundsGetElementPtr (bufty, outbuf, ArrayRef<Constant*> ({ zero, zero }));
+
+    /*
+     * bfc.drain (ptr, length): writes a whole span into the
+     * standard output, going on after short writes
+     *
+     */
+    auto drainty = FunctionType::get (ioret, { ioargs [1], offsetty }, false);
+    auto drain = Function::Create (drainty, link, "bfc.drain", module);
+    {
+      auto entry = BasicBlock::Create (*context, NONAME, drain);
+      auto loop = BasicBlock::Create (*context, NONAME, drain);
+      auto body = BasicBlock::Create (*context, NONAME, drain);
+      auto step = BasicBlock::Create (*context, NONAME, drain);
+      auto done = BasicBlock::Create (*context, NONAME, drain);
+      auto fail = BasicBlock::Create (*context, NONAME, drain);
+
+      b.SetInsertPoint (entry);
+      b.CreateBr (loop);
+
+      b.SetInsertPoint (loop);
+      auto ptr = b.CreatePHI (ioargs [1], 2);
+      auto left = b.CreatePHI (offsetty, 2);
+      b.CreateCondBr (b.CreateICmpSGT (left, zero), body, done);
+
+      b.SetInsertPoint (body);
+      auto wrote = b.CreateCall (writety, write, { ConstantInt::get (ioargs [0], 1, false), ptr, left });
+      b.CreateCondBr (b.CreateICmpSGT (wrote, zero), step, fail);
+
+      b.SetInsertPoint (step);
+      auto next = b.CreateInBoundsGEP (bytety, ptr, wrote);
+      auto rest = b.CreateSub (left, wrote);
+      b.CreateBr (loop);
+
+        ptr->addIncoming (drain->getArg (0), entry);
+        ptr->addIncoming (next, step);
+        left->addIncoming (drain->getArg (1), entry);
+        left->addIncoming (rest, step);
+
+      b.SetInsertPoint (done);
+      b.CreateRet (okay);
+      b.SetInsertPoint (fail);
+      b.CreateRet (failed);
+    }
+
+    /*
+     * bfc.flush (): drains the output buffer, which is left
+     * empty even if writing it fails
+     *
+     */
+    flush = Function::Create (FunctionType::get (ioret, false), link, "bfc.flush", module);
+    {
+      auto entry = BasicBlock::Create (*context, NONAME, flush);
+
+      b.SetInsertPoint (entry);
+      auto length = b.CreateLoad (offsetty, outlen);
+      b.CreateStore (zero, outlen);
+      b.CreateRet (b.CreateCall (drain, { outptr, length }));
+    }
+
+    /*
+     * bfc.fill (): flushes pending output (so prompts are seen
+     * before blocking on input) and refills the input buffer;
+     * returns the number of bytes read, zero on end of file
+     *
+     */
+    fill = Function::Create (FunctionType::get (offsetty, false), link, "bfc.fill", module);
+    {
+      auto entry = BasicBlock::Create (*context, NONAME, fill);
+      auto body = BasicBlock::Create (*context, NONAME, fill);
+      auto fail = BasicBlock::Create (*context, NONAME, fill);
+
+      b.SetInsertPoint (entry);
+      auto status = b.CreateCall (flush);
+      b.CreateCondBr (b.CreateICmpSLT (status, okay), fail, body);
+
+      b.SetInsertPoint (body);
+      auto got = b.CreateCall (readty, read, { ConstantInt::get (ioargs [0], 0, false), inptr, size });
+      auto length = b.CreateSelect (b.CreateICmpSGT (got, zero), got, zero);
+      b.CreateStore (zero, inpos);
+      b.CreateStore (length, inlen);
+      b.CreateRet (got);
+
+      b.SetInsertPoint (fail);
+      b.CreateRet (ConstantInt::get (offsetty, -1, true));
+    }
+
+    /*
+     * bfc.puts (ptr, length): appends a span to the output
+     * buffer, flushing it first if there is no room left; spans
+     * larger than the buffer itself are written directly
+     *
+     */
+    auto putsty = FunctionType::get (ioret, { ioargs [1], offsetty }, false);
+    puts = Function::Create (putsty, link, "bfc.puts", module);
+    {
+      auto entry = BasicBlock::Create (*context, NONAME, puts);
+      auto copy = BasicBlock::Create (*context, NONAME, puts);
+      auto spill = BasicBlock::Create (*context, NONAME, puts);
+      auto check = BasicBlock::Create (*context, NONAME, puts);
+      auto direct = BasicBlock::Create (*context, NONAME, puts);
+      auto fail = BasicBlock::Create (*context, NONAME, puts);
+      auto ptr = puts->getArg (0);
+      auto length = puts->getArg (1);
+
+      b.SetInsertPoint (entry);
+      auto used = b.CreateLoad (offsetty, outlen);
+      auto room = b.CreateSub (size, used);
+      b.CreateCondBr (b.CreateICmpULE (length, room), copy, spill);
+
+      b.SetInsertPoint (spill);
+      auto status = b.CreateCall (flush);
+      b.CreateCondBr (b.CreateICmpSLT (status, okay), fail, check);
+
+      b.SetInsertPoint (check);
+      b.CreateCondBr (b.CreateICmpULE (length, size), copy, direct);
+
+      b.SetInsertPoint (copy);
+      auto at = b.CreatePHI (offsetty, 2);
+        at->addIncoming (used, entry);
+        at->addIncoming (zero, check);
+      auto dest = b.CreateInBoundsGEP (bufty, outbuf, { zero, at });
+      b.CreateMemCpy (dest, MaybeAlign (1), ptr, MaybeAlign (1), length);
+      b.CreateStore (b.CreateAdd (at, length), outlen);
+      b.CreateRet (okay);
+
+      b.SetInsertPoint (direct);
+      b.CreateRet (b.CreateCall (drain, { ptr, length }));
+      b.SetInsertPoint (fail);
+      b.CreateRet (failed);
+    }
+
+    drain->addFnAttr (Attribute::NoUnwind);
+    flush->addFnAttr (Attribute::NoUnwind);
+    fill->addFnAttr (Attribute::NoUnwind);
+    puts->addFnAttr (Attribute::NoUnwind);
+  }
+
+  /*
+   * Declares the I/O runtime hosted by bfc itself (see
+   * Bfc::Runtime) in place of emitting one, so code run in
+   * process shares its buffers with the interpreter
+   *
+   */
+  inline void import (Module* module)
+  {
+    auto link = GlobalValue::ExternalLinkage;
+    auto bufty = ArrayType::get (Type::getInt8Ty (*context), BUFFERSZ);
+
+    inbuf = new GlobalVariable (*module, bufty, false, link, nullptr, "bfc.in");
+    inlen = new GlobalVariable (*module, offsetty, false, link, nullptr, "bfc.inlen");
+    inpos = new GlobalVariable (*module, offsetty, false, link, nullptr, "bfc.inpos");
+    outbuf = new GlobalVariable (*module, bufty, false, link, nullptr, "bfc.out");
+    outlen = new GlobalVariable (*module, offsetty, false, link, nullptr, "bfc.outlen");
+
+    flush = Function::Create (FunctionType::get (ioret, false), link, "bfc.flush", module);
+    fill = Function::Create (FunctionType::get (offsetty, false), link, "bfc.fill", module);
+    puts = Function::Create (FunctionType::get (ioret, { ioargs [1], offsetty }, false), link, "bfc.puts", module);
+
+    flush->addFnAttr (Attribute::NoUnwind);
+    fill->addFnAttr (Attribute::NoUnwind);
+    puts->addFnAttr (Attribute::NoUnwind);
+  }
+
+  /*
+   * Makes a raw Linux system call (x86-64 convention), with
+   * failures (-errno) turned into -1 as libc would
+   *
+   */
+  inline Value* syscall (IRBuilder<>& b, guint number, ArrayRef<Value*> args)
+  {
+    static const gchar* regs [] = { "{rdi}", "{rsi}", "{rdx}", "{r10}", "{r8}", "{r9}", };
+    auto i64 = b.getInt64Ty ();
+    auto types = std::vector<Type*> (1 + args.size (), i64);
+    auto values = std::vector<Value*> { ConstantInt::get (i64, number, false), };
+    auto constraints = std::string ("={rax},{rax}");
+
+    g_assert (args.size () <= G_N_ELEMENTS (regs));
+
+    for (guint i = 0; i < args.size (); ++i)
+    {
+      auto arg = args [i];
+
+      if (arg->getType ()->isPointerTy ())
+        values.push_back (b.CreatePtrToInt (arg, i64));
+      else
+        values.push_back (b.CreateSExtOrTrunc (arg, i64));
+
+      constraints += std::string (",") + regs [i];
+    }
+
+    constraints += ",~{rcx},~{r11},~{memory},~{dirflag},~{fpsr},~{flags}";
+
+    auto asmty = FunctionType::get (i64, types, false);
+    auto result = b.CreateCall (asmty, InlineAsm::get (asmty, "syscall", constraints, true), values);
+    auto failed = b.CreateICmpUGT (result, ConstantInt::get (i64, -4096, true));
+  return b.CreateSelect (failed, ConstantInt::get (i64, -1, true), result);
+  }
+
+  /*
+   * Defines memcpy (or memmove, or memset), which code
+   * generation may call for large copies and fills, byte by byte
+   * (and, being what the optimizer would call, without builtins)
+   *
+   */
+  inline void bytewise (Module* module, const gchar* name)
+  {
+    auto ptrty = ioargs [1];
+    auto bytety = Type::getInt8Ty (*context);
+    auto fill = !strcmp (name, "memset");
+    auto move = !strcmp (name, "memmove");
+    auto sourcety = fill ? (Type*) Type::getInt32Ty (*context) : ptrty;
+    auto type = FunctionType::get (ptrty, { ptrty, sourcety, offsetty }, false);
+    auto func = Function::Create (type, GlobalValue::ExternalLinkage, name, module);
+    auto entry = BasicBlock::Create (*context, NONAME, func);
+    auto loop = BasicBlock::Create (*context, NONAME, func);
+    auto done = BasicBlock::Create (*context, NONAME, func);
+    auto dest = func->getArg (0);
+    auto source = func->getArg (1);
+    auto size = func->getArg (2);
+    auto zero = ConstantInt::get (offsetty, 0, false);
+    auto one = ConstantInt::get (offsetty, 1, false);
+    IRBuilder<> b (entry);
+
+    func->addFnAttr (Attribute::NoUnwind);
+    func->addFnAttr ("no-builtins");
+
+    /*
+     * Moves to higher addresses go backwards, in case
+     * both areas overlap
+     *
+     */
+    auto backwards = (Value*) nullptr;
+
+    if (move)
+      backwards = b.CreateICmpUGT (b.CreatePtrToInt (dest, offsetty), b.CreatePtrToInt (source, offsetty));
+
+    b.CreateCondBr (b.CreateICmpEQ (size, zero), done, loop);
+    b.SetInsertPoint (loop);
+
+    auto index = b.CreatePHI (offsetty, 2);
+    auto next = b.CreateAdd (index, one);
+    auto at = (Value*) index;
+
+    if (move)
+      at = b.CreateSelect (backwards, b.CreateSub (size, next), index);
+
+    auto byte = fill
+      ? b.CreateTrunc (source, bytety)
+      : (Value*) b.CreateLoad (bytety, b.CreateInBoundsGEP (bytety, source, at));
+
+    b.CreateStore (byte, b.CreateInBoundsGEP (bytety, dest, at));
+    b.CreateCondBr (b.CreateICmpULT (next, size), loop, done);
+    index->addIncoming (zero, entry);
+    index->addIncoming (next, loop);
+
+    b.SetInsertPoint (done);
+    b.CreateRet (dest);
+  }
+
+  /*
+   * Turns the module into a program of its own, to be linked
+   * into an executable (see Bfc::link): whatever it calls from
+   * libc becomes a raw system call, and _start runs main and
+   * exits with its status
+   *
+   */
+  inline void freestanding (BfcOptions* opt, Module* module, GError** error)
+  {
+    static const struct { const gchar* name; guint number; } calls [] =
+    {
+      { "read", 0, },
+      { "write", 1, },
+      { "close", 3, },
+      { "mmap", 9, },
+      { "mprotect", 10, },
+      { "munmap", 11, },
+      { "madvise", 28, },
+      { "creat", 85, },
+    };
+
+    auto machine = (TargetMachine*) opt->machine;
+    auto triple = machine->getTargetTriple ();
+    IRBuilder<> b (*context);
+
+    if (triple.getArch () != Triple::x86_64 || !triple.isOSLinux ())
+    {
+      g_set_error
+      (error,
+       BFC_CODEGEN_ERROR,
+       BFC_CODEGEN_ERROR_FAILED,
+       "Executables can only be linked for x86-64 Linux targets (but objects can be emitted with -c)");
+      return;
+    }
+
+    for (auto& call : calls)
+    {
+      auto func = module->getFunction (call.name);
+
+      if (func != nullptr && func->isDeclaration ())
+      {
+        auto args = std::vector<Value*> ();
+        auto retty = func->getReturnType ();
+
+        for (auto& arg : func->args ())
+          args.push_back (&arg);
+
+        b.SetInsertPoint (BasicBlock::Create (*context, NONAME, func));
+        auto result = syscall (b, call.number, args);
+
+        if (retty->isPointerTy ())
+          b.CreateRet (b.CreateIntToPtr (result, retty));
+        else
+          b.CreateRet (b.CreateSExtOrTrunc (result, retty));
+
+        func->setLinkage (GlobalValue::InternalLinkage);
+        func->addFnAttr (Attribute::NoUnwind);
+      }
+    }
+
+    bytewise (module, "memcpy");
+    bytewise (module, "memmove");
+    bytewise (module, "memset");
+
+    /*
+     * The stack is only 16 byte aligned on entry, without
+     * the return address calls push
+     *
+     */
+    auto startty = FunctionType::get (b.getVoidTy (), false);
+    auto start = Function::Create (startty, GlobalValue::ExternalLinkage, "_start", module);
+      start->addFnAttr (Attribute::NoReturn);
+      start->addFnAttr (Attribute::NoUnwind);
+      start->addFnAttr (Attribute::getWithStackAlignment (*context, Align (16)));
+
+    b.SetInsertPoint (BasicBlock::Create (*context, NONAME, start));
+    syscall (b, 231, { b.CreateCall (main) });
+    b.CreateUnreachable ();
+  }
+
+  /*
+   * Emits (once per module) a routine which advances a cell
+   * pointer by stride until it rests on a zero cell. When the
+   * stride divides the number of cells in a chunk, whole aligned
+   * chunks are compared against zero at once and the first hit
+   * (the last one going backwards) is picked from the lane mask
+   *
+   */
+  Function* scanner (Module* module, gint stride)
+  {
+    auto found = scanners.find (stride);
+    if (found != scanners.end ())
+      return found->second;
+
+    auto unitsz = unit->getIntegerBitWidth () / 8;
+    auto lanes = CHUNKSZ / unitsz;
+    auto span = (guint) ABS (stride);
+    auto ptrty = PointerType::getUnqual (unit);
+    auto type = FunctionType::get (ptrty, { ptrty }, false);
+    auto link = GlobalValue::PrivateLinkage;
+    auto name = g_strdup_printf ("bfc.scan.%c%u", (stride > 0) ? 'f' : 'b', span);
+    auto func = Function::Create (type, link, name, module);
+    IRBuilder<> b (*context);
+      g_free (name);
+
+    auto entry = BasicBlock::Create (*context, NONAME, func);
+    auto head = BasicBlock::Create (*context, NONAME, func);
+    auto loop = BasicBlock::Create (*context, NONAME, func);
+    auto exit = BasicBlock::Create (*context, NONAME, func);
+    auto done = BasicBlock::Create (*context, NONAME, func);
+    auto start = func->getArg (0);
+    auto zero = ConstantInt::get (unit, 0, false);
+
+    func->addFnAttr (Attribute::NoUnwind);
+    func->addFnAttr (Attribute::ReadOnly);
+    func->addFnAttr (Attribute::ArgMemOnly);
+    scanners [stride] = func;
+
+    b.SetInsertPoint (entry);
+    {
+      auto value = b.CreateLoad (unit, start);
+      b.CreateCondBr (b.CreateICmpEQ (value, zero), done, head);
+      b.SetInsertPoint (done);
+      b.CreateRet (start);
+    }
+
+    if (span > lanes || (lanes % span) != 0)
+    {
+      b.SetInsertPoint (head);
+      b.CreateBr (loop);
+
+      b.SetInsertPoint (loop);
+      auto ptr = b.CreatePHI (ptrty, 2);
+      auto next = b.CreateInBoundsGEP (unit, ptr, b.getInt32 (stride));
+      auto value = b.CreateLoad (unit, next);
+        ptr->addIncoming (start, head);
+        ptr->addIncoming (next, loop);
+      b.CreateCondBr (b.CreateICmpEQ (value, zero), exit, loop);
+
+      b.SetInsertPoint (exit);
+      b.CreateRet (next);
+    }
+    else
+    {
+      auto vecty = FixedVectorType::get (unit, lanes);
+      auto maskty = Type::getIntNTy (*context, lanes);
+      auto bytety = b.getInt8Ty ();
+      auto addrty = b.getInt64Ty ();
+      guint64 pattern = 0;
+
+      for (guint i = 0; i < lanes; i += span)
+        pattern |= (G_GUINT64_CONSTANT (1) << i);
+
+      b.SetInsertPoint (head);
+      auto addr = b.CreatePtrToInt (start, addrty);
+      auto misalign = b.CreateAnd (addr, CHUNKSZ - 1);
+      auto bytes = b.CreateBitCast (start, PointerType::getUnqual (bytety));
+      auto chunk = b.CreateGEP (bytety, bytes, b.CreateNeg (misalign));
+      auto lane = b.CreateTrunc (b.CreateUDiv (misalign, ConstantInt::get (addrty, unitsz)), maskty);
+      auto phase = b.CreateAnd (lane, span - 1);
+      auto every = b.CreateShl (ConstantInt::get (maskty, pattern), phase);
+      auto ones = ConstantInt::getAllOnesValue (maskty);
+      Value* valid;
+
+      if (stride > 0)
+        valid = b.CreateShl (ones, lane);
+      else
+        valid = b.CreateLShr (ones, b.CreateSub (ConstantInt::get (maskty, lanes - 1), lane));
+
+      auto first = b.CreateAnd (every, valid);
+      b.CreateBr (loop);
+
+      b.SetInsertPoint (loop);
+      auto ptr = b.CreatePHI (bytes->getType (), 2);
+      auto mask = b.CreatePHI (maskty, 2);
+      auto vector = b.CreateAlignedLoad (vecty, b.CreateBitCast (ptr, PointerType::getUnqual (vecty)), MaybeAlign (CHUNKSZ));
+      auto zeros = b.CreateICmpEQ (vector, ConstantAggregateZero::get (vecty));
+      auto hits = b.CreateAnd (b.CreateBitCast (zeros, maskty), mask);
+      auto next = b.CreateGEP (bytety, ptr, b.getInt32 ((stride > 0) ? CHUNKSZ : - (gint) CHUNKSZ));
+        ptr->addIncoming (chunk, head);
+        ptr->addIncoming (next, loop);
+        mask->addIncoming (first, head);
+        mask->addIncoming (every, loop);
+      b.CreateCondBr (b.CreateICmpNE (hits, ConstantInt::get (maskty, 0)), exit, loop);
+
+      b.SetInsertPoint (exit);
+      Value* index;
+
+      if (stride > 0)
+        index = b.CreateBinaryIntrinsic (Intrinsic::cttz, hits, b.getTrue ());
+      else
+      {
+        index = b.CreateBinaryIntrinsic (Intrinsic::ctlz, hits, b.getTrue ());
+        index = b.CreateSub (ConstantInt::get (maskty, lanes - 1), index);
+      }
+
+      index = b.CreateZExt (index, b.getInt32Ty ());
+      auto cells = b.CreateBitCast (ptr, ptrty);
+      b.CreateRet (b.CreateInBoundsGEP (unit, cells, index));
+    }
+  return func;
+  }
+
+  /*
+   * Emits ops [first, last) at the current insertion point,
+   * starting from the cursor member
+   *
+   */
+  inline void generate (BfcOptions* opt, Bfc::Program* program, gsize first, gsize last, GError** error)
+  {
+    GQueue iterators = G_QUEUE_INIT;
+    Value* value = NULL;
+    Value* aux = NULL;
+
+    auto& ops = program->ops;
+    auto checked = opt->checkbelt && !opt->beltwrap;
+    gint64 lo, hi, moved;
+
+  /*
+   * With belt checks on, cells [wlo, whi] (relative to the
+   * cursor) are those already known to lie within the belt:
+   * all of it from the start, since the cursor position is
+   * known there, down to nothing after a scan or in the body
+   * of a loop which moves the cursor. Straight-line accesses
+   * are checked at once when first needed, up to the next I/O
+   * op, and those of a loop which brings the cursor back where
+   * it entered (with no I/O or inner loops of its own) once it
+   * is entered, so only loops which walk the belt pay for a
+   * check on every iteration. Either way a program stops right
+   * where the interpreter would, with the same output. Nothing
+   * is known when starting midway
+   *
+   */
+    gboolean known = (first == 0);
+    gint64 wlo = - (gint64) program->initial.cursor;
+    gint64 whi = (gint64) beltsz - 1 - (gint64) program->initial.cursor;
+
+  /*
+   * The cursor is an SSA pointer into the belt (kept in the
+   * cursor member): moves just rebuild it, and loops merge its
+   * incoming values through phi nodes. On a wrapping belt it is
+   * instead a cell index, masked on every update, and so it is
+   * with belt checks on (unmasked), as an in-bounds pointer may
+   * not even be formed past the belt for the checks to test it
+   *
+   */
+  #define CURSOR_MOVE(delta) \
     G_STMT_START { \
-      auto __aux = ((value)); \
-      builder->CreateStore (__aux, cursor); \
+      auto __delta = ConstantInt::get (offsetty, (delta), true); \
+      if (!indexed) \
+        cursor = builder->CreateInBoundsGEP (unit, cursor, __delta); \
+      else if (!opt->beltwrap) \
+        cursor = builder->CreateAdd (cursor, __delta); \
+      else \
+        cursor = builder->CreateAnd (builder->CreateAdd (cursor, __delta), beltsz - 1); \
     } G_STMT_END
-  #define BELT_PTR() \
+  #define BELT_PTR(offset) \
     (G_GNUC_EXTENSION ({ \
-      builder->CreateInBoundsGEP (unit, belt, CURSOR_GET ()); \
+      auto __offset = ((offset)); \
+      auto __delta = ConstantInt::get (offsetty, __offset, true); \
+      (!indexed) \
+        ? ((__offset == 0) ? cursor \
+          : builder->CreateInBoundsGEP (unit, cursor, __delta)) \
+        : builder->CreateInBoundsGEP (unit, belt, (__offset == 0) ? cursor \
+          : (!opt->beltwrap) ? builder->CreateAdd (cursor, __delta) \
+          : builder->CreateAnd (builder->CreateAdd (cursor, __delta), beltsz - 1)); \
     }))
-  #define BELT_GET() \
+  #define BELT_GET(offset) \
     (G_GNUC_EXTENSION ({ \
-      builder->CreateLoad (unit, BELT_PTR ()); \
+      builder->CreateLoad (unit, BELT_PTR ((offset))); \
     }))
-  #define BELT_SET(value) \
+  #define BELT_SET(offset,value) \
     G_STMT_START { \
       auto __aux = ((value)); \
-      builder->CreateStore (__aux, BELT_PTR ()); \
+      builder->CreateStore (__aux, BELT_PTR ((offset))); \
+    } G_STMT_END
+  #define BELT_CHECK(lo,hi) \
+    G_STMT_START { \
+      gint64 __lo = ((lo)), __hi = ((hi)); \
+      if (checked && (!known || __lo < wlo || __hi > whi)) \
+      { \
+        if (known) \
+        { \
+          __lo = MIN (__lo, wlo); \
+          __hi = MAX (__hi, whi); \
+        } \
+        checkbelt (__lo, __hi); \
+        known = TRUE; \
+        wlo = __lo; \
+        whi = __hi; \
+      } \
     } G_STMT_END
 
-    while (1)
+    for (gsize i = first; i < last; ++i)
     {
-      line = g_data_input_stream_read_line (stream, &length, NULL, &tmperr);
-      if (G_UNLIKELY (tmperr != NULL))
+      auto& op = ops [i];
+
+      switch (op.code)
       {
-        g_propagate_error (error, tmperr);
-        return;
-      }
+        case Bfc::op_move:
+        case Bfc::op_open:
+        case Bfc::op_close:
+        case Bfc::op_scan:
+        case Bfc::op_print:
+          break;
+        default:
+          if (checked)
+          {
+            auto end = i + 1;
 
-    #define GUARD(var) \
-      G_STMT_START { \
-        if ((var) == 0) \
-        { \
-          if (in_backwards > 0) \
-            goto putbackward; \
-          if (in_forwards > 0) \
-            goto putforward; \
-          if (in_dec > 0) \
-            goto putdec; \
-          if (in_inc > 0) \
-            goto putinc; \
-        } \
-      } G_STMT_END
+            program->extent (i, i + 1, &lo, &hi, &moved);
 
-      if (line == NULL)
-        break;
-      else
-      {
-        Value* index = NULL;
-        Value* value = NULL;
-        Value* aux = NULL;
-        gchar* ptr = line;
-        gchar* top = ptr + length;
-        gunichar c;
-
-        do
-        {
-          c = g_utf8_get_char (ptr);
+            if (!known || lo < wlo || hi > whi)
+            {
+              if (program->plain (i, end))
+                while (end < last && ops [end].code != Bfc::op_move && program->plain (end, end + 1))
+                  ++end;
 
-          switch (c)
-          {
-            case (gunichar) '<':
-              GUARD (in_backwards);
-              ++in_backwards;
-              break;
-            case (gunichar) '>':
-              GUARD (in_forwards);
-              ++in_forwards;
-              break;
-            case (gunichar) '-':
-              GUARD (in_dec);
-              ++in_dec;
-              break;
-            case (gunichar) '+':
-              GUARD (in_inc);
-              ++in_inc;
-              break;
-
-            case (gunichar) ',':
-              GUARD (0);
-              {
-                Value* args [] =
-                {
-                  ConstantInt::get (ioargs [0], 0, false),
-                  builder->CreateBitCast (BELT_PTR (), ioargs [1]),
-                  ConstantInt::get (ioargs [2], 1, false),
-                };
-
-                value = builder->CreateCall (readty, read, args);
-                goto checkio;
-              }
-            case (gunichar) '.':
-              GUARD (0);
-              {
-                value = BELT_GET ();
-                Value* args [] =
-                {
-                  ConstantInt::get (ioargs [0], 1, false),
-                  builder->CreateBitCast (BELT_PTR (), ioargs [1]),
-                  ConstantInt::get (ioargs [2], 1, false),
-                };
-
-                value = builder->CreateCall (writety, write, args);
-                goto checkio;
-              }
-
-            case (gunichar) '[':
-              GUARD (0);
-              {
-                gchar* n1 = g_utf8_next_char (ptr);
-                gchar* n2 = g_utf8_next_char (n1);
-                gboolean normal = TRUE;
-                if (n2 < ptr)
-                {
-                  gunichar c1 = g_utf8_get_char (n1);
-                  gunichar c2 = g_utf8_get_char (n2);
-                  if (c1 == (gunichar) '-' && c2 == (gunichar) ']')
-                  {
-                    BELT_SET (ConstantInt::get (unit, 0, false));
-                    normal = FALSE;
-                    ptr = n2;
-                  }
-                }
-
-                if (normal)
-                {
-                  BfcIterator* iter;
-                  BasicBlock* start;
-                  BasicBlock* end;
-                  BasicBlock* block;
-                  Function* parent;
-
-                  block = builder->GetInsertBlock ();
-                  parent = block->getParent ();
-                  start = BasicBlock::Create (*context, NONAME, parent);
-                  block = BasicBlock::Create (*context, NONAME, parent);
-                  end = BasicBlock::Create (*context, NONAME, parent);
-
-                  builder->CreateBr (start);
-                  builder->SetInsertPoint (start);
-
-                  aux = ConstantInt::get (unit, 0, 0);
-                  value = BELT_GET ();
-                  value = builder->CreateICmpEQ (value, aux);
-
-                  builder->CreateCondBr (value, end, block);
-                  builder->SetInsertPoint (block);
-
-                  iter = BfcIterator::alloc ();
-                  iter->start = start;
-                  iter->end = end;
-                  g_queue_push_head (&iterators, iter);
-                }
-              }
-              break;
-            case (gunichar) ']':
-              GUARD (0);
-              {
-                if (iterators.length == 0)
-                {
-                  g_set_error
-                  (error,
-                  BFC_CODEGEN_ERROR,
-                  BFC_CODEGEN_ERROR_FAILED,
-                  "%s: %i: %i: Unmatched ']' token",
-                    input->filename, n_line, n_column);
-                  CLEANUP (return);
-                }
-                else
-                {
-                  BfcIterator* iter;
-                  iter = (BfcIterator*) g_queue_pop_head (&iterators);
-
-                  aux = ConstantInt::get (unit, 0, 0);
-                  value = BELT_GET ();
-                  value = builder->CreateICmpEQ (value, aux);
-
-                  builder->CreateCondBr (value, iter->end, iter->start);
-                  builder->SetInsertPoint (iter->end);
-                  BfcIterator::free (iter);
-                }
-              }
-              break;
-
-            default:
-              if (opt->strict
-                && !(g_unichar_iscntrl (c)
-                  || g_unichar_isspace (c)))
-              {
-                gchar buffer [8] = {0};
-                gint wrote = 0;
-
-                wrote = g_unichar_to_utf8 (c, buffer);
-
-                g_set_error
-                (error,
-                BFC_CODEGEN_ERROR,
-                BFC_CODEGEN_ERROR_FAILED,
-                "%s: %i: %i: Unknown character '%.*s'",
-                  input->filename, n_line, n_column,
-                  wrote, buffer);
-                CLEANUP (return);
-              }
-              break;
-
-            putbackward:
-              index = CURSOR_GET ();
-              aux = ConstantInt::get (cursorty, in_backwards, false);
-              CURSOR_SET (builder->CreateSub (index, aux));
-              in_backwards = 0;
-              continue;
-            putforward:
-              index = CURSOR_GET ();
-              aux = ConstantInt::get (cursorty, in_forwards, false);
-              CURSOR_SET (builder->CreateAdd (index, aux));
-              in_forwards = 0;
-              continue;
-            putdec:
-              value = BELT_GET ();
-              aux = ConstantInt::get (unit, in_dec, false);
-              BELT_SET (builder->CreateSub (value, aux));
-              in_dec = 0;
-              continue;
-            putinc:
-              value = BELT_GET ();
-              aux = ConstantInt::get (unit, in_inc, false);
-              BELT_SET (builder->CreateAdd (value, aux));
-              in_inc = 0;
-              continue;
-
-            checkio:
-              if (opt->checkio)
-              {
-                auto block = builder->GetInsertBlock ();
-                auto parent = block->getParent ();
-                auto then = BasicBlock::Create (*context, NONAME, parent);
-
-                aux = ConstantInt::get (ioret, 0, false);
-                value = builder->CreateICmpSLT (value, aux);
-
-                builder->CreateCondBr (value, ioerr, then);
-                builder->SetInsertPoint (then);
-              }
-              break;
+              program->extent (i, end, &lo, &hi, &moved);
+              BELT_CHECK (lo, hi);
+            }
           }
-
-          ptr = g_utf8_next_char (ptr);
-          ++n_column;
-        }
-        while (ptr < top);
+          break;
       }
 
-      ++n_line;
-    #undef GUARD
-    }
+      switch (op.code)
+      {
+        case Bfc::op_move:
+          CURSOR_MOVE (op.value);
+          wlo -= op.value;
+          whi -= op.value;
+          break;
+        case Bfc::op_add:
+          value = BELT_GET (op.offset);
+          aux = ConstantInt::get (unit, op.value, true);
+          BELT_SET (op.offset, builder->CreateAdd (value, aux));
+          break;
+        case Bfc::op_set:
+          aux = ConstantInt::get (unit, op.value, true);
+          BELT_SET (op.offset, aux);
+          break;
+        case Bfc::op_mul:
+          value = BELT_GET (op.source);
+          aux = ConstantInt::get (unit, op.value, true);
+          value = (op.value == 1) ? value : builder->CreateMul (value, aux);
+          aux = BELT_GET (op.offset);
+          BELT_SET (op.offset, builder->CreateAdd (aux, value));
+          break;
+        case Bfc::op_scan:
+          BELT_CHECK (0, 0);
+
+          if (!opt->beltwrap && (!checked || ABS (op.value) <= CHUNKSZ / (unit->getIntegerBitWidth () / 8)))
+          {
+            auto module = builder->GetInsertBlock ()->getModule ();
+            auto func = scanner (module, (gint) op.value);
+
+            if (!indexed)
+              cursor = builder->CreateCall (func, { cursor });
+            else
+            {
+              auto unitsz = unit->getIntegerBitWidth () / 8;
+              auto start = builder->CreatePtrToInt (belt, offsetty);
+              auto at = builder->CreatePtrToInt (builder->CreateCall (func, { BELT_PTR (0) }), offsetty);
+              cursor = builder->CreateExactSDiv (builder->CreateSub (at, start), ConstantInt::get (offsetty, unitsz, false));
+            }
+
+            /*
+             * The belt is padded with zero cells (never written,
+             * as writes are checked) at least as wide as the stride,
+             * so the scan stops there at worst
+             *
+             */
+            known = FALSE;
+            BELT_CHECK (0, 0);
+          }
+          else
+          {
+            /*
+             * Scans which wrap around the belt, or whose strides
+             * could jump over the padding (so every step is checked),
+             * are plain loops
+             *
+             */
+            auto entry = builder->GetInsertBlock ();
+            auto parent = entry->getParent ();
+            auto head = BasicBlock::Create (*context, NONAME, parent);
+            auto step = BasicBlock::Create (*context, NONAME, parent);
+            auto exit = BasicBlock::Create (*context, NONAME, parent);
+
+            builder->CreateBr (head);
+            builder->SetInsertPoint (head);
+            auto ptr = builder->CreatePHI (cursor->getType (), 2);
+              ptr->addIncoming (cursor, entry);
+            cursor = ptr;
+            aux = ConstantInt::get (unit, 0, false);
+            builder->CreateCondBr (builder->CreateICmpEQ (BELT_GET (0), aux), exit, step);
+
+            builder->SetInsertPoint (step);
+            CURSOR_MOVE (op.value);
+
+            if (checked)
+              checkbelt (0, 0);
+            ptr->addIncoming (cursor, builder->GetInsertBlock ());
+            builder->CreateBr (head);
+
+            builder->SetInsertPoint (exit);
+            cursor = ptr;
+            known = TRUE;
+            wlo = whi = 0;
+          }
+          break;
+
+        /*
+         * Fast path of the I/O runtime: a byte is taken from the
+         * input buffer unless it is drained, and only then the
+         * runtime is called (see putbyte for output)
+         *
+         */
+        case Bfc::op_read:
+          {
+            auto entry = builder->GetInsertBlock ();
+            auto parent = entry->getParent ();
+            auto slow = BasicBlock::Create (*context, NONAME, parent);
+            auto fast = BasicBlock::Create (*context, NONAME, parent);
+            auto done = BasicBlock::Create (*context, NONAME, parent);
+            auto bufty = inbuf->getValueType ();
+            auto zero = ConstantInt::get (offsetty, 0, false);
+            auto weights = MDBuilder (*context).createBranchWeights (1 << 10, 1);
+
+            auto pos = builder->CreateLoad (offsetty, inpos);
+            auto len = builder->CreateLoad (offsetty, inlen);
+            builder->CreateCondBr (builder->CreateICmpULT (pos, len), fast, slow, weights);
+
+            builder->SetInsertPoint (slow);
+            value = builder->CreateCall (fill);
+            checkio (opt, value);
+            builder->CreateCondBr (builder->CreateICmpSGT (value, zero), fast, done);
+            auto refilled = builder->GetInsertBlock ();
+
+            builder->SetInsertPoint (fast);
+            auto at = builder->CreatePHI (offsetty, 2);
+              at->addIncoming (pos, entry);
+              at->addIncoming (zero, refilled);
+            value = builder->CreateLoad (builder->getInt8Ty (), builder->CreateInBoundsGEP (bufty, inbuf, { zero, at }));
+            builder->CreateStore (builder->CreateAdd (at, ConstantInt::get (offsetty, 1, false)), inpos);
+            BELT_SET (op.offset, builder->CreateZExtOrTrunc (value, unit));
+            builder->CreateBr (done);
+
+            builder->SetInsertPoint (done);
+          }
+          break;
+        case Bfc::op_write:
+          if (op.value > 1 && unit->getIntegerBitWidth () == 8 && !opt->beltwrap)
+            putspan (opt, BELT_PTR (op.offset), op.value);
+          else
+          {
+            for (gint64 j = 0; j < op.value; ++j)
+              putbyte (opt, BELT_GET (op.offset + j));
+          }
+          break;
+        case Bfc::op_print:
+          {
+            auto& text = program->strings [op.value];
+            auto module = builder->GetInsertBlock ()->getModule ();
+            auto string = builder->CreateGlobalStringPtr (text, "text", 0, module);
 
-    if (G_UNLIKELY (iterators.length > 0))
-    {
-      g_set_error
-      (error,
-      BFC_CODEGEN_ERROR,
-      BFC_CODEGEN_ERROR_FAILED,
-      "%s: %i: %i: Unmatched ']' token",
-        input->filename, n_line, n_column);
-      CLEANUP (return);
+            putspan (opt, string, text.size ());
+          }
+          break;
+
+        /*
+         * Loops are emitted rotated: the condition is tested once
+         * before entering the body and once at its end, so each
+         * iteration costs a single test and branch
+         *
+         */
+        case Bfc::op_open:
+          {
+            BfcIterator* iter;
+            BasicBlock* entry;
+            Function* parent;
+
+            iter = BfcIterator::alloc ();
+            iter->balanced = checked && program->extent (i + 1, op.jump, &lo, &hi, &moved) && moved == 0;
+
+            BELT_CHECK (0, 0);
+
+            iter->lo = wlo;
+            iter->hi = whi;
+
+            entry = builder->GetInsertBlock ();
+            parent = entry->getParent ();
+            iter->body = BasicBlock::Create (*context, NONAME, parent);
+            iter->end = BasicBlock::Create (*context, NONAME, parent);
+
+            aux = ConstantInt::get (unit, 0, 0);
+            value = BELT_GET (0);
+            value = builder->CreateICmpEQ (value, aux);
+            count (i, 0, nullptr);
+            count (i, 1, value);
+
+            iter->exit = PHINode::Create (cursor->getType (), 2, NONAME, iter->end);
+            iter->exit->addIncoming (cursor, entry);
+
+            /*
+             * A balanced loop is checked as a whole on its way in,
+             * when all it does (before it could output anything) is
+             * touching every cell of its extent
+             *
+             */
+            if (!iter->balanced || (lo >= wlo && hi <= whi) || !program->plain (i + 1, op.jump))
+              builder->CreateCondBr (value, iter->end, iter->body, weigh (i, FALSE));
+            else
+            {
+              auto enter = BasicBlock::Create (*context, NONAME, parent, iter->body);
+
+              builder->CreateCondBr (value, iter->end, enter, weigh (i, FALSE));
+              builder->SetInsertPoint (enter);
+              BELT_CHECK (lo, hi);
+              builder->CreateBr (iter->body);
+            }
+
+            auto preheader = builder->GetInsertBlock ();
+            builder->SetInsertPoint (iter->body);
+            iter->cursor = builder->CreatePHI (cursor->getType (), 2);
+            iter->cursor->addIncoming (cursor, preheader);
+            cursor = iter->cursor;
+
+            /*
+             * The cursor is back at the same cell on every iteration
+             * of a balanced loop, which is not obvious from its phi
+             *
+             */
+            if (!checked || !iter->balanced)
+              known = !checked;
+            else
+              builder->CreateAssumption (inbelt (wlo, whi));
+
+            g_queue_push_head (&iterators, iter);
+          }
+          break;
+        case Bfc::op_close:
+          {
+            BfcIterator* iter;
+            BasicBlock* latch;
+
+            iter = (BfcIterator*) g_queue_pop_head (&iterators);
+            BELT_CHECK (0, 0);
+            latch = builder->GetInsertBlock ();
+
+            aux = ConstantInt::get (unit, 0, 0);
+            value = BELT_GET (0);
+            value = builder->CreateICmpEQ (value, aux);
+            count (op.jump, 2, value);
+            builder->CreateCondBr (value, iter->end, iter->body, weigh (op.jump, TRUE));
+
+            iter->cursor->addIncoming (cursor, latch);
+            iter->exit->addIncoming (cursor, latch);
+
+            builder->SetInsertPoint (iter->end);
+            cursor = iter->exit;
+
+            known = TRUE;
+
+            if (iter->balanced)
+            {
+              wlo = iter->lo;
+              whi = iter->hi;
+            }
+            else
+            {
+              wlo = whi = 0;
+            }
+
+            BfcIterator::free (iter);
+          }
+          break;
+      }
     }
 
-  #undef GUARD
+  #undef BELT_CHECK
   #undef BELT_SET
   #undef BELT_GET
   #undef BELT_PTR
-  #undef CURSOR_SET
-  #undef CURSOR_GET
-    CLEANUP ();
-  #undef CLEANUP
+  #undef CURSOR_MOVE
+    g_queue_clear_full (&iterators, BfcIterator::free);
   }
 
+  /*
+   * Runs the new pass manager's default pipeline for the
+   * optimization level (or the one given with --passes) over
+   * the module, which is set up for the target machine first so
+   * cost models (vectorizer's, unroller's and the like) see it.
+   * Bitcode gets the ThinLTO pre-link pipeline instead, which
+   * leaves what pays off after inlining to link time
+   *
+   */
   inline void optimize (BfcOptions* opt, Module* module, GError** error)
   {
-    auto pass = legacy::FunctionPassManager (module);
-    auto level = opt->olevel;
-
+    auto machine = (TargetMachine*) opt->machine;
+    auto level = OptimizationLevel::O0;
+    auto lto = opt->emitll && !opt->assemble && !opt->run;
+    auto tuning = PipelineTuningOptions ();
+      tuning.LoopUnrolling = opt->olevel > 1;
+      tuning.LoopVectorization = opt->olevel > 1;
+      tuning.SLPVectorization = opt->olevel > 1;
+
+    if (opt->sizelevel == 1)
+      level = OptimizationLevel::Os;
+    else
+    if (opt->sizelevel == 2)
+      level = OptimizationLevel::Oz;
+    else
+    switch (opt->olevel)
     {
-      pass.add (llvm::createVerifierPass ());
-
-      if (level > 0)
-      {
-        pass.add (llvm::createInstructionCombiningPass ());
-        pass.add (llvm::createReassociatePass ());
-        pass.add (llvm::createGVNPass ());
-        pass.add (llvm::createCFGSimplificationPass ());
+      case 0: level = OptimizationLevel::O0; break;
+      case 1: level = OptimizationLevel::O1; break;
+      case 2: level = OptimizationLevel::O2; break;
+      default: level = OptimizationLevel::O3; break;
+    }
 
-        if (level == 1)
+    module->setDataLayout (machine->createDataLayout ());
+    module->setTargetTriple (machine->getTargetTriple ().getTriple ());
+
+    auto loops = LoopAnalysisManager ();
+    auto functions = FunctionAnalysisManager ();
+    auto cgsccs = CGSCCAnalysisManager ();
+    auto modules = ModuleAnalysisManager ();
+    auto builder = PassBuilder (machine, tuning);
+    auto passes = ModulePassManager ();
+
+    builder.registerModuleAnalyses (modules);
+    builder.registerCGSCCAnalyses (cgsccs);
+    builder.registerFunctionAnalyses (functions);
+    builder.registerLoopAnalyses (loops);
+    builder.crossRegisterProxies (loops, functions, cgsccs, modules);
+
+    /*
+     * Code a profile shows cold is moved out of the way of
+     * the hot loops (see BfcState::summarize)
+     *
+     */
+    if (opt->profuse != nullptr)
+      builder.registerOptimizerLastEPCallback ([] (ModulePassManager& passes, OptimizationLevel level)
         {
-          pass.add (llvm::createDeadCodeEliminationPass ());
-        }
-      }
+          if (level != OptimizationLevel::O0)
+            passes.addPass (HotColdSplittingPass ());
+        });
+
+    passes.addPass (VerifierPass ());
 
-      if (level > 1)
+    if (opt->passes != nullptr)
+    {
+      if (auto err = builder.parsePassPipeline (passes, opt->passes))
       {
-        pass.add (llvm::createPromoteMemoryToRegisterPass ());
-        pass.add (llvm::createAggressiveDCEPass ());
+        auto message = toString (std::move (err));
+        g_set_error
+        (error,
+         BFC_CODEGEN_ERROR,
+         BFC_CODEGEN_ERROR_FAILED,
+         "%s", message.c_str ());
+        return;
       }
-
-      pass.doInitialization ();
     }
+    else
+    if (level == OptimizationLevel::O0)
+      passes.addPass (builder.buildO0DefaultPipeline (level, lto));
+    else
+    if (lto)
+      passes.addPass (builder.buildThinLTOPreLinkDefaultPipeline (level));
+    else
+      passes.addPass (builder.buildPerModuleDefaultPipeline (level));
 
-    auto begin = module->begin ();
-    auto end = module->end ();
-
-    for (auto iter = begin; iter != end; ++iter)
-      pass.run (*iter);
-    pass.doFinalization ();
+    passes.run (*module, modules);
   }
 
   inline void dump (BfcOptions* opt, Module* module, GError** error)
@@ -479,14 +1837,34 @@ public:
     if (opt->assemble && opt->emitll)
     {
       module->print (stream, nullptr, true, false);
-      stream.flush ();
+    }
+    else
+    if (opt->emitll)
+    {
+      /*
+       * Bitcode carries a module summary (and hash), so
+       * it takes part in ThinLTO as well as in full LTO
+       *
+       */
+      auto profile = ProfileSummaryInfo (*module);
+      auto index = buildModuleSummaryIndex (*module, nullptr, &profile);
+
+      WriteBitcodeToFile (*module, stream, false, &index, true);
     }
     else
     {
       auto type = (opt->assemble) ? CGFT_AssemblyFile : CGFT_ObjectFile;
       auto pass = legacy::PassManager ();
+      auto object = SmallString<0> ();
+      raw_svector_ostream buffer (object);
+
+      /*
+       * Executables are linked from an object kept in memory
+       *
+       */
+      auto& target = (opt->link) ? (raw_pwrite_stream&) buffer : (raw_pwrite_stream&) stream;
 
-      if (machine->addPassesToEmitFile (pass, stream, nullptr, type))
+      if (machine->addPassesToEmitFile (pass, target, nullptr, type))
       {
         g_set_error
         (error,
@@ -498,9 +1876,252 @@ public:
       else
       {
         pass.run (*module);
-        stream.flush ();
       }
+
+      if (opt->link)
+      {
+        auto tmperr = (GError*) nullptr;
+
+        Bfc::link (object, stream, &tmperr);
+
+        if (G_UNLIKELY (tmperr != nullptr))
+        {
+          g_propagate_error (error, tmperr);
+          return;
+        }
+      }
+    }
+
+    stream.commit (error);
+  }
+
+  /*
+   * Sets up an ORC JIT for the target machine, failing unless
+   * it is the host's; symbols not found in the modules given to
+   * it are looked up in bfc's own process
+   *
+   */
+  static std::unique_ptr<orc::LLJIT> jit (BfcOptions* opt, GError** error)
+  {
+    auto machine = (TargetMachine*) opt->machine;
+    auto triple = machine->getTargetTriple ();
+    auto host = Triple (sys::getProcessTriple ());
+
+  #define THROW(err) \
+    G_STMT_START { \
+      auto __message = toString ((err)); \
+      g_set_error \
+      (error, \
+       BFC_CODEGEN_ERROR, \
+       BFC_CODEGEN_ERROR_FAILED, \
+       "%s", __message.c_str ()); \
+      return nullptr; \
+    } G_STMT_END
+
+    if (triple.getArch () != host.getArch () || triple.getOS () != host.getOS ())
+    {
+      g_set_error
+      (error,
+       BFC_CODEGEN_ERROR,
+       BFC_CODEGEN_ERROR_FAILED,
+       "Can not run code for %s on %s",
+       triple.str ().c_str (),
+       host.str ().c_str ());
+      return nullptr;
+    }
+
+    auto target = orc::JITTargetMachineBuilder (triple);
+      target.setCPU (machine->getTargetCPU ().str ());
+      target.getFeatures () = SubtargetFeatures (machine->getTargetFeatureString ());
+      target.setCodeGenOptLevel (machine->getOptLevel ());
+
+    auto jit = orc::LLJITBuilder ()
+      .setJITTargetMachineBuilder (std::move (target))
+      .create ();
+    if (!jit)
+      THROW (jit.takeError ());
+
+    auto prefix = (*jit)->getDataLayout ().getGlobalPrefix ();
+    auto symbols = orc::DynamicLibrarySearchGenerator::GetForCurrentProcess (prefix);
+    if (!symbols)
+      THROW (symbols.takeError ());
+
+    (*jit)->getMainJITDylib ().addGenerator (std::move (*symbols));
+  #undef THROW
+    return std::move (*jit);
+  }
+
+  /*
+   * Runs the module in process through an ORC JIT, sharing
+   * bfc's own standard input and output. The module, and the
+   * context it lives in, are handed over to the JIT, so a fresh
+   * context is set up for the modules to come
+   *
+   */
+  inline void run (BfcOptions* opt, Module* module, GError** error)
+  {
+    auto owned = std::unique_ptr<Module> (module);
+    auto shared = orc::ThreadSafeModule (std::move (owned), orc::ThreadSafeContext (std::move (context)));
+
+    context = std::unique_ptr<LLVMContext> (new LLVMContext ());
+    builder = std::unique_ptr<IRBuilder<>> (new IRBuilder<> (*context));
+
+  #define THROW(err) \
+    G_STMT_START { \
+      auto __message = toString ((err)); \
+      g_set_error \
+      (error, \
+       BFC_CODEGEN_ERROR, \
+       BFC_CODEGEN_ERROR_FAILED, \
+       "%s", __message.c_str ()); \
+      return; \
+    } G_STMT_END
+
+    auto engine = jit (opt, error);
+    if (!engine)
+      return;
+
+    if (auto err = engine->addIRModule (std::move (shared)))
+      THROW (std::move (err));
+
+    auto symbol = engine->lookup ("main");
+    if (!symbol)
+      THROW (symbol.takeError ());
+
+    auto entry = (gint (*) (void)) symbol->getAddress ();
+    auto status = entry ();
+
+    if (status != 0)
+    {
+      g_set_error
+      (error,
+       BFC_CODEGEN_ERROR,
+       BFC_CODEGEN_ERROR_FAILED,
+       "Program exited with status %i",
+       status);
+      return;
     }
+  #undef THROW
+  }
+
+  /*
+   * Tiered execution: the program starts running at once in the
+   * interpreter (see Bfc::Interpreter), while the loops it finds
+   * hot are compiled one at a time on a background thread, each
+   * into a module (and context) of its own, and switched to from
+   * their next header on
+   *
+   */
+  inline void tier (BfcOptions* opt, Bfc::Program* program, GError** error)
+  {
+    Bfc::Bytecode bytecode (opt, program);
+    auto interpreter = Bfc::Interpreter (&bytecode);
+    auto tmperr = (GError*) nullptr;
+
+  #define THROW(err) \
+    G_STMT_START { \
+      auto __message = toString ((err)); \
+      g_set_error \
+      (error, \
+       BFC_CODEGEN_ERROR, \
+       BFC_CODEGEN_ERROR_FAILED, \
+       "%s", __message.c_str ()); \
+      return; \
+    } G_STMT_END
+
+    auto engine = jit (opt, error);
+    if (!engine)
+      return;
+
+    auto& library = engine->getMainJITDylib ();
+    auto mangle = orc::MangleAndInterner (engine->getExecutionSession (), engine->getDataLayout ());
+    auto flags = JITSymbolFlags::Exported;
+    auto symbols = orc::SymbolMap ();
+
+    symbols [mangle ("bfc.in")] = JITEvaluatedSymbol (pointerToJITTargetAddress (Bfc::Runtime::in), flags);
+    symbols [mangle ("bfc.inlen")] = JITEvaluatedSymbol (pointerToJITTargetAddress (&Bfc::Runtime::inlen), flags);
+    symbols [mangle ("bfc.inpos")] = JITEvaluatedSymbol (pointerToJITTargetAddress (&Bfc::Runtime::inpos), flags);
+    symbols [mangle ("bfc.out")] = JITEvaluatedSymbol (pointerToJITTargetAddress (Bfc::Runtime::out), flags);
+    symbols [mangle ("bfc.outlen")] = JITEvaluatedSymbol (pointerToJITTargetAddress (&Bfc::Runtime::outlen), flags);
+    symbols [mangle ("bfc.fill")] = JITEvaluatedSymbol (pointerToJITTargetAddress (&Bfc::Runtime::fill), flags);
+    symbols [mangle ("bfc.flush")] = JITEvaluatedSymbol (pointerToJITTargetAddress (&Bfc::Runtime::flush), flags);
+    symbols [mangle ("bfc.puts")] = JITEvaluatedSymbol (pointerToJITTargetAddress (&Bfc::Runtime::puts), flags);
+
+    if (auto err = library.define (orc::absoluteSymbols (std::move (symbols))))
+      THROW (std::move (err));
+  #undef THROW
+
+    auto tier = BfcTier { opt, program, engine.get (), &interpreter, nullptr };
+    auto pool = g_thread_pool_new (compile, &tier, 1, FALSE, &tmperr);
+
+    if (G_UNLIKELY (tmperr != nullptr))
+    {
+      g_propagate_error (error, tmperr);
+      return;
+    }
+
+    tier.pool = pool;
+    interpreter.hot = BfcTier::hot;
+    interpreter.data = &tier;
+
+    auto status = interpreter.run (error);
+
+    /*
+     * Compilations still queued are dropped, while the running
+     * one (if any) is waited for, as it uses the JIT
+     *
+     */
+    g_thread_pool_free (pool, TRUE, TRUE);
+
+    if (status != 0 && (error == nullptr || *error == nullptr))
+    {
+      g_set_error
+      (error,
+       BFC_CODEGEN_ERROR,
+       BFC_CODEGEN_ERROR_FAILED,
+       "Program exited with status %i",
+       status);
+      return;
+    }
+  }
+
+  /*
+   * Compiles a hot loop (with a state of its own, as contexts
+   * are not thread-safe) and hands the resulting code over to
+   * the interpreter; loops which fail to compile just keep being
+   * interpreted
+   *
+   */
+  static void compile (gpointer data, gpointer ptier)
+  {
+    auto self = (BfcTier*) ptier;
+    auto open = GPOINTER_TO_SIZE (data) - 1;
+    auto tmperr = (GError*) nullptr;
+    auto state = BfcState ();
+    auto module = std::unique_ptr<Module> (new Module ("loop", *(state.context)));
+
+    state.loop (self->opt, self->program, open, module.get (), &tmperr);
+    if (G_LIKELY (tmperr == nullptr))
+      state.optimize (self->opt, module.get (), &tmperr);
+    if (G_UNLIKELY (tmperr != nullptr))
+    {
+      g_error_free (tmperr);
+      return;
+    }
+
+    state.builder.reset ();
+
+    auto name = g_strdup_printf ("bfc.loop.%" G_GSIZE_FORMAT, open);
+    auto shared = orc::ThreadSafeModule (std::move (module), orc::ThreadSafeContext (std::move (state.context)));
+
+    if (auto err = self->jit->addIRModule (std::move (shared)))
+      consumeError (std::move (err));
+    else if (auto symbol = self->jit->lookup (name))
+      self->interpreter->install (open, (Bfc::Interpreter::Native) symbol->getAddress ());
+    else
+      consumeError (symbol.takeError ());
+
+    g_free (name);
   }
 
   std::unique_ptr<LLVMContext> context;
@@ -508,36 +2129,64 @@ public:
 private:
   FunctionType *mainty, *readty, *writety;
   Function* main, *read, *write;
-  Value *belt, *cursor;
-  Type *unit, *cursorty, *ioret, *ioargs [3];
-  BasicBlock* ioerr;
+  Function *fill, *flush, *puts;
+  GlobalVariable *inbuf, *inlen, *inpos, *outbuf, *outlen;
+  Value *base, *belt, *cursor, *mapping;
+  gsize beltsz, mapsz;
+  gboolean indexed;
+  Type *unit, *offsetty, *ioret, *ioargs [3];
+  BasicBlock *ioerr, *ooberr;
+  std::map<gint, Function*> scanners;
+  GlobalVariable* counters;
+  std::map<gsize, gsize> loops;
+  std::map<gsize, BfcCounts> profile;
 };
 
 enum Passes
 {
+  pass_parse,
+  pass_simplify,
+  pass_measure,
+  pass_evaluate,
+  pass_propagate,
+  pass_tier,
   pass_prologue,
   pass_generate,
   pass_epilogue,
+  pass_freestanding,
   pass_optimize,
   pass_dump,
+  pass_run,
   pass_max,
 };
 
 void
-bfc_main (BfcOptions* opt, GError** error)
+bfc_initialize (void)
 {
-  if (opt->assemble)
-    InitializeAllAsmPrinters ();
-  else
+  static gsize initialized = 0;
+
+  /*
+   * Batch compilations call this from several
+   * workers at once, so targets are set up once
+   *
+   */
+  if (g_once_init_enter (&initialized))
   {
     InitializeAllTargetInfos ();
     InitializeAllTargets ();
     InitializeAllTargetMCs ();
     InitializeAllAsmParsers ();
     InitializeAllAsmPrinters ();
+    g_once_init_leave (&initialized, 1);
   }
+}
+
+void
+bfc_main (BfcOptions* opt, GError** error)
+{
+  bfc_initialize ();
 
-  if (opt->compile && opt->n_inputs > 1)
+  if ((opt->compile || opt->link) && opt->n_inputs > 1)
   {
     g_set_error
     (error,
@@ -553,6 +2202,7 @@ bfc_main (BfcOptions* opt, GError** error)
   for (guint i = 0; i < opt->n_inputs; ++i)
   {
     auto stream = & opt->inputs [i];
+    auto program = Bfc::Program ();
     auto module = (Module*) nullptr;
     auto name = (gchar*) stream->filename;
 
@@ -567,20 +2217,54 @@ bfc_main (BfcOptions* opt, GError** error)
     for (guint j = 0; j < pass_max; ++j)
     switch (j)
     {
+      case pass_parse:
+        program.parse (opt, stream, &tmperr);
+        goto check;
+      case pass_simplify:
+        program.simplify (opt);
+        goto check;
+      case pass_measure:
+        program.measure (opt);
+        goto check;
+      case pass_evaluate:
+        program.evaluate (opt);
+        goto check;
+      case pass_propagate:
+        program.propagate (opt);
+        goto check;
+      case pass_tier:
+        if (opt->tiered)
+        {
+          state.tier (opt, &program, &tmperr);
+          j = pass_max;
+        }
+        goto check;
       case pass_prologue:
-        state.prologue (opt, module, &tmperr);
+        state.prologue (opt, &program, module, &tmperr);
         goto check;
       case pass_generate:
-        state.generate (opt, stream, &tmperr);
+        state.generate (opt, &program, 0, program.ops.size (), &tmperr);
         goto check;
       case pass_epilogue:
         state.epilogue (opt, module, &tmperr);
         goto check;
+      case pass_freestanding:
+        if (opt->link)
+          state.freestanding (opt, module, &tmperr);
+        goto check;
       case pass_optimize:
         state.optimize (opt, module, &tmperr);
         goto check;
       case pass_dump:
-        state.dump (opt, module, &tmperr);
+        if (!opt->run)
+          state.dump (opt, module, &tmperr);
+        goto check;
+      case pass_run:
+        if (opt->run)
+        {
+          state.run (opt, module, &tmperr);
+          module = nullptr;
+        }
         goto check;
 
       check:
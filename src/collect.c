@@ -122,12 +122,108 @@ collect_codegen (BfcOptions* opt, gboolean static_, guint pic, guint pie, const
   opt->pie = pie;
 }
 
+void
+collect_optimize (BfcOptions* opt, const gchar* level, const gchar* passes, GError** error)
+{
+  if (!g_strcmp0 (level, "s"))
+  {
+    opt->olevel = 2;
+    opt->sizelevel = 1;
+  }
+  else
+  if (!g_strcmp0 (level, "z"))
+  {
+    opt->olevel = 2;
+    opt->sizelevel = 2;
+  }
+  else
+  if (level [0] >= '0' && level [0] <= '3' && level [1] == 0)
+  {
+    opt->olevel = level [0] - '0';
+    opt->sizelevel = 0;
+  }
+  else
+    THROW ("Unknown optimization level %s (must be 0, 1, 2, 3, s or z)", level);
+
+  opt->passes = passes;
+}
+
+void
+collect_belt (BfcOptions* opt, gint64 beltsz, gint cellbits, gboolean lazy, gboolean wrap, GError** error)
+{
+  switch (cellbits)
+  {
+    case 8:
+    case 16:
+    case 32:
+    case 64:
+      break;
+    default:
+      THROW ("Unsupported cell width %i (must be 8, 16, 32 or 64)", cellbits);
+  }
+
+  if (beltsz < 0)
+    THROW ("Invalid belt size %" G_GINT64_FORMAT, beltsz);
+  if ((guint64) beltsz > (G_MAXSIZE / 4) / (cellbits / 8))
+    THROW ("Belt size %" G_GINT64_FORMAT " is too large", beltsz);
+  if (wrap && opt->checkbelt)
+    THROW ("Can not have both belt checks and a wrapping belt");
+
+  opt->beltsz = (gsize) beltsz;
+  opt->cellbits = cellbits;
+  opt->lazybelt = lazy;
+  opt->beltwrap = wrap;
+}
+
+/*
+ * A machine kept warm by a server, handed to the first
+ * compilation asking for one just like it (requests run
+ * on a process of their own, so each one gets it)
+ *
+ */
+static struct
+{
+  LLVMTargetMachineRef machine;
+  gchar* arch;
+  gchar* features;
+  gchar* tune;
+  guint mmodel;
+  guint reloc;
+} warm;
+
+void
+collect_warm (BfcOptions* opt, const gchar* arch, const gchar* tune, const gchar* features)
+{
+  warm.machine = opt->machine;
+  warm.arch = g_strdup (arch);
+  warm.features = g_strdup (features);
+  warm.tune = g_strdup (tune);
+  warm.mmodel = opt->mmodel;
+  warm.reloc = opt->reloc;
+  opt->machine = NULL;
+}
+
 void
 collect_machine (BfcOptions* opt, const gchar* arch, const gchar* tune, const gchar* features, GError** error)
 {
   LLVMTargetMachineRef machine = NULL;
   LLVMTargetRef target = NULL;
 
+  if (warm.machine != NULL
+    && warm.mmodel == opt->mmodel
+    && warm.reloc == opt->reloc
+    && !g_strcmp0 (warm.arch, arch)
+    && !g_strcmp0 (warm.features, features)
+    && !g_strcmp0 (warm.tune, tune))
+  {
+    opt->arch = (arch != NULL) ? arch : LLVM_HOST_TRIPLE;
+    opt->features = features;
+    opt->machine = warm.machine;
+    opt->tune = tune;
+    warm.machine = NULL;
+    return;
+  }
+
   if (arch != NULL)
   {
     LLVMTargetRef iter;
@@ -51,10 +51,16 @@ enum
 #define COLLECT_PIC(pic,PIC) ((pic) | ((PIC) << 1))
 #define COLLECT_PIE(pie,PIE) ((pie) | ((PIE) << 1))
 
+G_GNUC_INTERNAL void
+collect_belt (BfcOptions* opt, gint64 beltsz, gint cellbits, gboolean lazy, gboolean wrap, GError** error);
 G_GNUC_INTERNAL void
 collect_codegen (BfcOptions* opt, gboolean static_, guint pic, guint pie, const gchar* mmodel, GError** error);
 G_GNUC_INTERNAL void
+collect_optimize (BfcOptions* opt, const gchar* level, const gchar* passes, GError** error);
+G_GNUC_INTERNAL void
 collect_machine (BfcOptions* opt, const gchar* arch, const gchar* tune, const gchar* features, GError** error);
+G_GNUC_INTERNAL void
+collect_warm (BfcOptions* opt, const gchar* arch, const gchar* tune, const gchar* features);
 
 G_END_DECLS
 
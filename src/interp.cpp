@@ -0,0 +1,406 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <interp.hpp>
+#include <memory>
+#include <runtime.hpp>
+
+using namespace Bfc;
+
+G_DEFINE_QUARK (bfc-interpreter-error-quark, bfc_interpreter_error);
+#define BFC_INTERPRETER_ERROR (bfc_interpreter_error_quark ())
+#define BFC_INTERPRETER_ERROR_FAILED (0)
+
+/*
+ * Back-edges a loop takes before it is reported hot
+ *
+ */
+static const guint HOTLOOP = 1024;
+
+Interpreter::Interpreter (const Bytecode* bytecode)
+  : hot (nullptr), data (nullptr), bytecode (bytecode)
+{
+}
+
+void
+Interpreter::install (gsize open, Native native)
+{
+  g_atomic_pointer_set (&natives [open], (gpointer) native);
+}
+
+/*
+ * Dispatch is threaded through a table of label addresses, so
+ * every handler ends in an indirect jump of its own (which
+ * predicts far better than the single one of a switch). Belt
+ * flavours are template parameters, so none of them costs a
+ * thing to the others
+ *
+ */
+template<typename T, gboolean wrap, gboolean checked>
+gint
+Interpreter::execute (T* belt)
+{
+  static const gpointer handlers [] =
+  {
+    &&do_add,
+    &&do_move,
+    &&do_open,
+    &&do_close,
+    &&do_read,
+    &&do_write,
+    &&do_set,
+    &&do_mul,
+    &&do_scan,
+    &&do_print,
+    &&do_halt,
+  };
+
+  G_STATIC_ASSERT (G_N_ELEMENTS (handlers) == insn_halt + 1);
+
+  auto header = bytecode->header;
+  auto insns = bytecode->insns;
+  auto checkio = (header->flags & BYTECODE_CHECKIO) != 0;
+  auto tiered = hot != nullptr;
+  auto size = (guintptr) header->beltsz;
+  auto mask = (gintptr) header->beltsz - 1;
+  auto at = (gintptr) header->cursor;
+  auto pc = insns;
+
+  for (guint64 i = 0; i < header->n_cells; ++i)
+    belt [i] = (T) bytecode->cells [i];
+
+  /*
+   * The cursor is kept as a cell index, masked on every move on
+   * a wrapping belt; with belt checks on, every cell is checked
+   * before being touched, as compiled code does
+   *
+   */
+#define CELL(offset) (belt [(wrap) ? ((at + (offset)) & mask) : (at + (offset))])
+#define CHECK(offset) \
+  G_STMT_START { \
+    if (checked && (guintptr) (at + (offset)) >= size) \
+      return -2; \
+  } G_STMT_END
+#define MOVE(delta) \
+  G_STMT_START { \
+    at += ((delta)); \
+    if (wrap) \
+      at &= mask; \
+  } G_STMT_END
+#define NATIVE(native) \
+  G_STMT_START { \
+    auto __slot = (wrap || checked) ? at : (gintptr) (belt + at); \
+    auto __status = (native) (belt, &__slot); \
+    if (__status != 0) \
+      return __status; \
+    at = (wrap || checked) ? __slot : (T*) __slot - belt; \
+  } G_STMT_END
+#define DISPATCH() goto *handlers [pc->code]
+#define NEXT() \
+  G_STMT_START { \
+    ++pc; \
+    DISPATCH (); \
+  } G_STMT_END
+
+  DISPATCH ();
+
+do_add:
+  CHECK (pc->offset);
+  CELL (pc->offset) += (T) pc->value;
+  NEXT ();
+do_move:
+  MOVE (pc->value);
+  NEXT ();
+do_set:
+  CHECK (pc->offset);
+  CELL (pc->offset) = (T) pc->value;
+  NEXT ();
+do_mul:
+  CHECK (pc->source);
+  CHECK (pc->offset);
+  CELL (pc->offset) += (T) ((guint64) CELL (pc->source) * (guint64) pc->value);
+  NEXT ();
+do_scan:
+  CHECK (0);
+  while (CELL (0) != 0)
+  {
+    MOVE (pc->value);
+    CHECK (0);
+  }
+  NEXT ();
+do_read:
+  CHECK (pc->offset);
+
+  if (Runtime::inpos >= Runtime::inlen)
+  {
+    auto got = Runtime::fill ();
+    if (got < 0 && checkio)
+      return -1;
+    if (got <= 0)
+      NEXT ();
+  }
+
+  CELL (pc->offset) = (T) Runtime::in [Runtime::inpos++];
+  NEXT ();
+do_write:
+  CHECK (pc->offset);
+  CHECK (pc->offset + pc->value - 1);
+
+  for (gint64 j = 0; j < pc->value; ++j)
+  {
+    if (Runtime::outlen >= BUFFERSZ && Runtime::flush () < 0 && checkio)
+      return -1;
+    Runtime::out [Runtime::outlen++] = (guint8) CELL (pc->offset + j);
+  }
+  NEXT ();
+do_print:
+  if (Runtime::puts ((const guint8*) bytecode->data + pc->value, pc->jump) < 0 && checkio)
+    return -1;
+  NEXT ();
+
+/*
+ * A loop with native code installed runs there as a whole
+ * (from the header test to its exit), so the interpreter resumes
+ * right past its op_close
+ *
+ */
+do_open:
+  CHECK (0);
+
+  if (CELL (0) == 0)
+  {
+    pc = insns + pc->jump;
+    DISPATCH ();
+  }
+
+  if (tiered)
+  {
+    if (auto native = (Native) g_atomic_pointer_get (&natives [pc - insns]))
+    {
+      NATIVE (native);
+      pc = insns + pc->jump;
+      DISPATCH ();
+    }
+  }
+  NEXT ();
+do_close:
+  CHECK (0);
+
+  if (CELL (0) == 0)
+    NEXT ();
+
+  if (tiered)
+  {
+    auto open = pc->jump - 1;
+    auto& count = counts [open];
+
+    if (count < HOTLOOP && ++count == HOTLOOP)
+      hot (open, data);
+    if (auto native = (Native) g_atomic_pointer_get (&natives [open]))
+    {
+      NATIVE (native);
+      NEXT ();
+    }
+  }
+
+  pc = insns + pc->jump;
+  DISPATCH ();
+do_halt:
+  return 0;
+
+#undef NEXT
+#undef DISPATCH
+#undef NATIVE
+#undef MOVE
+#undef CHECK
+#undef CELL
+}
+
+template<typename T>
+gint
+Interpreter::execute (T* belt)
+{
+  auto flags = bytecode->header->flags;
+
+  if (flags & BYTECODE_WRAP)
+    return execute<T, TRUE, FALSE> (belt);
+  else if (flags & BYTECODE_CHECKBELT)
+    return execute<T, FALSE, TRUE> (belt);
+  else
+    return execute<T, FALSE, FALSE> (belt);
+}
+
+/*
+ * Runs the program to its end, returning its exit status as
+ * a compiled one would (see BfcState::epilogue)
+ *
+ */
+gint
+Interpreter::run (GError** error)
+{
+  auto header = bytecode->header;
+  auto checkio = (header->flags & BYTECODE_CHECKIO) != 0;
+  auto unitsz = header->cellbits / 8;
+  auto bytes = unitsz * header->beltsz + 2 * CHUNKSZ;
+  auto base = (guint8*) g_try_malloc0 (bytes);
+  gint status = 0;
+
+  if (base == nullptr)
+  {
+    g_set_error
+    (error,
+     BFC_INTERPRETER_ERROR,
+     BFC_INTERPRETER_ERROR_FAILED,
+     "Can not allocate a belt of %" G_GUINT64_FORMAT " cells",
+     header->beltsz);
+    return -1;
+  }
+
+  counts.assign (header->n_insns, 0);
+  natives.assign (header->n_insns, nullptr);
+
+  if (Runtime::puts ((const guint8*) bytecode->data, header->n_output) < 0 && checkio)
+    status = -1;
+  else
+  {
+    auto belt = base + CHUNKSZ;
+
+    switch (unitsz)
+    {
+      case 1: status = execute<guint8> ((guint8*) belt); break;
+      case 2: status = execute<guint16> ((guint16*) belt); break;
+      case 4: status = execute<guint32> ((guint32*) belt); break;
+      default: status = execute<guint64> ((guint64*) belt); break;
+    }
+  }
+
+  /*
+   * Whatever was buffered is written out even on failure (as
+   * the exit paths of compiled programs do)
+   *
+   */
+  if (Runtime::flush () < 0 && checkio && status == 0)
+    status = -1;
+
+  g_free (base);
+  return status;
+}
+
+enum Passes
+{
+  pass_load,
+  pass_parse,
+  pass_simplify,
+  pass_measure,
+  pass_evaluate,
+  pass_propagate,
+  pass_assemble,
+  pass_write,
+  pass_run,
+  pass_max,
+};
+
+/*
+ * Counterpart of bfc_main which never touches LLVM: inputs are
+ * turned into bytecode (or mapped as is, when they are already
+ * bytecode images) and either run by the interpreter or written
+ * out for later runs
+ *
+ */
+void
+bfc_bytecode (BfcOptions* opt, GError** error)
+{
+  if (opt->emitbc && opt->n_inputs > 1)
+  {
+    g_set_error
+    (error,
+     BFC_INTERPRETER_ERROR,
+     BFC_INTERPRETER_ERROR_FAILED,
+     "Bytecode is emitted for only one file at a time");
+    return;
+  }
+
+  auto tmperr = (GError*) nullptr;
+
+  for (guint i = 0; i < opt->n_inputs; ++i)
+  {
+    auto stream = & opt->inputs [i];
+    auto program = Program ();
+    auto bytecode = std::unique_ptr<Bytecode> ();
+
+    for (guint j = 0; j < pass_max; ++j)
+    switch (j)
+    {
+      case pass_load:
+        if (g_strcmp0 (stream->filename, "-") != 0)
+          bytecode.reset (Bytecode::load (stream->filename, &tmperr));
+        goto check;
+      case pass_parse:
+        if (bytecode == nullptr)
+          program.parse (opt, stream, &tmperr);
+        goto check;
+      case pass_simplify:
+        if (bytecode == nullptr)
+          program.simplify (opt);
+        goto check;
+      case pass_measure:
+        if (bytecode == nullptr)
+          program.measure (opt);
+        goto check;
+      case pass_evaluate:
+        if (bytecode == nullptr)
+          program.evaluate (opt);
+        goto check;
+      case pass_propagate:
+        if (bytecode == nullptr)
+          program.propagate (opt);
+        goto check;
+      case pass_assemble:
+        if (bytecode == nullptr)
+          bytecode.reset (new Bytecode (opt, &program));
+        goto check;
+      case pass_write:
+        if (opt->emitbc)
+          bytecode->write ((GOutputStream*) opt->output.stream, &tmperr);
+        goto check;
+      case pass_run:
+        if (!opt->emitbc)
+        {
+          auto interpreter = Interpreter (bytecode.get ());
+          auto status = interpreter.run (&tmperr);
+
+          if (status != 0 && tmperr == nullptr)
+            g_set_error
+            (&tmperr,
+             BFC_INTERPRETER_ERROR,
+             BFC_INTERPRETER_ERROR_FAILED,
+             "Program exited with status %i",
+             status);
+        }
+        goto check;
+
+      check:
+        if (G_UNLIKELY (tmperr != nullptr))
+        {
+          g_propagate_error (error, tmperr);
+          return;
+        }
+        break;
+    }
+  }
+}
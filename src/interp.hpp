@@ -0,0 +1,66 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_INTERP__
+#define __BFC_INTERP__ 1
+#include <bfc.h>
+#include <bytecode.hpp>
+#include <vector>
+
+namespace Bfc
+{
+  /*
+   * Runs bytecode (see Bfc::Bytecode), and is the first tier
+   * of tiered execution as well: back-edges are then counted per
+   * loop, and once a loop has taken enough of them it is reported
+   * through hot. A native version of it may then be installed (from
+   * any thread), which is entered from the next time the loop
+   * header is reached. Instructions share their index with the ops
+   * they come from, so loops are named by the index of their op_open
+   *
+   */
+  class Interpreter
+  {
+  public:
+    /*
+     * Native loops take the belt and a slot holding the cursor
+     * (a cell pointer, or a cell index on wrapping or checked
+     * belts), run the whole loop from its header, update the slot
+     * and return as compiled programs exit (zero, or a negative
+     * status)
+     *
+     */
+    typedef gint (*Native) (gpointer belt, gintptr* cursor);
+    typedef void (*Hot) (gsize open, gpointer data);
+
+    Interpreter (const Bytecode* bytecode);
+    gint run (GError** error);
+    void install (gsize open, Native native);
+
+    Hot hot;
+    gpointer data;
+  private:
+    template<typename T, gboolean wrap, gboolean checked> gint execute (T* belt);
+    template<typename T> gint execute (T* belt);
+
+    const Bytecode* bytecode;
+    std::vector<guint> counts;
+    std::vector<gpointer> natives;
+  };
+}
+
+#endif // __BFC_INTERP__
@@ -0,0 +1,379 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <link.hpp>
+#include <llvm/ADT/Triple.h>
+#include <llvm/BinaryFormat/ELF.h>
+#include <llvm/Object/ELFObjectFile.h>
+#include <map>
+#include <string.h>
+#include <vector>
+
+using namespace llvm;
+
+G_DEFINE_QUARK (bfc-link-error-quark, bfc_link_error);
+#define BFC_LINK_ERROR (bfc_link_error_quark ())
+#define BFC_LINK_ERROR_FAILED (0)
+
+/*
+ * Executables are loaded at BASE as two segments: code (which
+ * takes the headers and read-only data along) and data (with the
+ * global offset table and zero-filled data last). File offsets
+ * and addresses only differ by BASE, so the data segment starts
+ * on a page of its own
+ *
+ */
+static const guint64 BASE = 0x400000;
+static const guint64 PAGESZ = 0x1000;
+static const guint N_PHDRS = 3;
+
+enum Segment
+{
+  segment_code,
+  segment_data,
+  segment_bss,
+  segment_none,
+};
+
+static inline guint64
+align (guint64 value, guint64 alignment)
+{
+  alignment = MAX (alignment, 1);
+return (value + alignment - 1) / alignment * alignment;
+}
+
+static Segment
+classify (const object::ELFSectionRef& section)
+{
+  auto flags = section.getFlags ();
+
+  if ((flags & ELF::SHF_ALLOC) == 0)
+    return segment_none;
+  else
+  if ((flags & ELF::SHF_WRITE) == 0)
+    return segment_code;
+  else
+  if (section.getType () == ELF::SHT_NOBITS)
+    return segment_bss;
+  else
+    return segment_data;
+}
+
+void
+Bfc::link (StringRef object, raw_ostream& output, GError** error)
+{
+#define THROW(...) \
+  G_STMT_START { \
+    g_set_error \
+    (error, \
+     BFC_LINK_ERROR, \
+     BFC_LINK_ERROR_FAILED, \
+     __VA_ARGS__); \
+    return; \
+  } G_STMT_END
+#define CHECK(expected) \
+  G_STMT_START { \
+    if (!(expected)) \
+    { \
+      auto __message = toString ((expected).takeError ()); \
+      THROW ("%s", __message.c_str ()); \
+    } \
+  } G_STMT_END
+
+  auto parsed = object::ELF64LEObjectFile::create (MemoryBufferRef (object, "bfc"));
+    CHECK (parsed);
+  auto& file = *parsed;
+
+  if (file.getArch () != Triple::x86_64)
+    THROW ("Can only link x86-64 objects");
+
+  auto image = std::vector<char> (sizeof (ELF::Elf64_Ehdr) + N_PHDRS * sizeof (ELF::Elf64_Phdr));
+  auto addresses = std::map<guint64, guint64> ();
+  auto slots = std::map<guint64, guint64> ();
+  guint64 bounds [segment_none][2];
+
+  /*
+   * Symbols loaded through the global offset table get a slot
+   * of their own, whichever the relocation reaching it
+   *
+   */
+  for (auto& relocs : file.sections ())
+  for (auto& reloc : relocs.relocations ())
+  switch (reloc.getType ())
+  {
+    case ELF::R_X86_64_GOTPCREL:
+    case ELF::R_X86_64_GOTPCRELX:
+    case ELF::R_X86_64_REX_GOTPCRELX:
+      {
+        auto symbol = reloc.getSymbol ();
+
+        if (symbol != file.symbol_end ())
+        {
+          auto key = symbol->getRawDataRefImpl ().p;
+
+          if (slots.count (key) == 0)
+            slots.emplace (key, slots.size ());
+        }
+      }
+      break;
+  }
+
+  /*
+   * Lay sections out, segment by segment
+   *
+   */
+  auto got = (guint64) 0;
+  auto top = (guint64) 0;
+
+  for (guint segment = 0; segment < segment_none; ++segment)
+  {
+    if (segment == segment_data)
+      image.resize (align (image.size (), PAGESZ));
+
+    top = (segment == segment_bss) ? top : image.size ();
+    bounds [segment][0] = top;
+
+    for (auto& section : file.sections ())
+    if (classify (section) == segment)
+    {
+      top = align (top, section.getAlignment ());
+      addresses [section.getIndex ()] = BASE + top;
+
+      if (segment == segment_bss)
+        top += section.getSize ();
+      else
+      {
+        auto contents = section.getContents ();
+          CHECK (contents);
+
+        image.resize (top);
+        image.insert (image.end (), contents->begin (), contents->end ());
+        top = image.size ();
+      }
+    }
+
+    if (segment == segment_data)
+    {
+      top = align (top, 8);
+      got = BASE + top;
+      image.resize (top + 8 * slots.size ());
+      top = image.size ();
+    }
+
+    bounds [segment][1] = top;
+  }
+
+  /*
+   * Symbols all have to be defined here (undefined weak ones
+   * resolve to null)
+   *
+   */
+  auto resolve = [&] (object::symbol_iterator symbol) -> Expected<guint64>
+    {
+      if (symbol == file.symbol_end ())
+        return 0;
+
+      auto flags = symbol->getFlags ();
+      auto name = symbol->getName ();
+      auto section = symbol->getSection ();
+      auto value = symbol->getValue ();
+
+      if (!flags) return flags.takeError ();
+      if (!name) return name.takeError ();
+      if (!section) return section.takeError ();
+      if (!value) return value.takeError ();
+
+      if (*flags & object::SymbolRef::SF_Undefined)
+      {
+        if (*flags & object::SymbolRef::SF_Weak)
+          return 0;
+        else
+          return createStringError (inconvertibleErrorCode (), "Undefined reference to '%s'", name->str ().c_str ());
+      }
+
+      if (*section == file.section_end ())
+        return *value;
+
+      auto found = addresses.find ((*section)->getIndex ());
+
+      if (found == addresses.end ())
+        return createStringError (inconvertibleErrorCode (), "Reference to '%s', which is not loaded", name->str ().c_str ());
+    return found->second + *value;
+    };
+
+  for (auto& symbol : file.symbols ())
+  {
+    auto found = slots.find (symbol.getRawDataRefImpl ().p);
+
+    if (found != slots.end ())
+    {
+      auto value = resolve (object::symbol_iterator (symbol));
+        CHECK (value);
+
+      memcpy (image.data () + (got - BASE) + 8 * found->second, &*value, 8);
+    }
+  }
+
+  /*
+   * Apply relocations (S being the symbol, A the addend, P the
+   * place and G the symbol's offset table slot)
+   *
+   */
+  for (auto& relocs : file.sections ())
+  {
+    auto target = relocs.getRelocatedSection ();
+      CHECK (target);
+
+    if (*target == file.section_end ()
+      || addresses.count ((*target)->getIndex ()) == 0)
+      continue;
+
+    for (auto& reloc : relocs.relocations ())
+    {
+      auto place = addresses [(*target)->getIndex ()] + reloc.getOffset ();
+      auto at = image.data () + (place - BASE);
+      auto addend = object::ELFRelocationRef (reloc).getAddend ();
+        CHECK (addend);
+      auto symbol = resolve (reloc.getSymbol ());
+        CHECK (symbol);
+
+      auto S = *symbol;
+      auto A = (guint64) *addend;
+      auto P = place;
+      auto G = (guint64) 0;
+
+      if (reloc.getSymbol () != file.symbol_end ())
+      {
+        auto found = slots.find (reloc.getSymbol ()->getRawDataRefImpl ().p);
+        G = (found == slots.end ()) ? 0 : got + 8 * found->second;
+      }
+
+    #define PATCH(type,expr,fits) \
+      G_STMT_START { \
+        auto __value = ((expr)); \
+        if (!(fits)) \
+          THROW ("Relocation out of range"); \
+        else \
+        { \
+          auto __patch = (type) __value; \
+          memcpy (at, &__patch, sizeof (__patch)); \
+        } \
+      } G_STMT_END
+
+      switch (reloc.getType ())
+      {
+        case ELF::R_X86_64_NONE:
+          break;
+        case ELF::R_X86_64_64:
+          PATCH (guint64, S + A, TRUE);
+          break;
+        case ELF::R_X86_64_PC64:
+          PATCH (guint64, S + A - P, TRUE);
+          break;
+        case ELF::R_X86_64_32:
+          PATCH (guint32, S + A, __value <= G_MAXUINT32);
+          break;
+        case ELF::R_X86_64_32S:
+          PATCH (gint32, (gint64) (S + A), __value >= G_MININT32 && __value <= G_MAXINT32);
+          break;
+        case ELF::R_X86_64_PC32:
+        case ELF::R_X86_64_PLT32:
+          PATCH (gint32, (gint64) (S + A - P), __value >= G_MININT32 && __value <= G_MAXINT32);
+          break;
+        case ELF::R_X86_64_GOTPCREL:
+        case ELF::R_X86_64_GOTPCRELX:
+        case ELF::R_X86_64_REX_GOTPCRELX:
+          PATCH (gint32, (gint64) (G + A - P), __value >= G_MININT32 && __value <= G_MAXINT32);
+          break;
+        default:
+          {
+            auto name = SmallString<32> ();
+              reloc.getTypeName (name);
+            THROW ("Unsupported relocation %s", name.c_str ());
+          }
+          break;
+      }
+    #undef PATCH
+    }
+  }
+
+  /*
+   * Headers go last, now everything has its place
+   *
+   */
+  auto entry = (guint64) 0;
+
+  for (auto& symbol : file.symbols ())
+  {
+    auto name = symbol.getName ();
+      CHECK (name);
+
+    if (*name == "_start")
+    {
+      auto value = resolve (object::symbol_iterator (symbol));
+        CHECK (value);
+      entry = *value;
+    }
+  }
+
+  if (entry == 0)
+    THROW ("Undefined entry point '_start'");
+
+  auto ehdr = ELF::Elf64_Ehdr ();
+  auto phdrs = std::vector<ELF::Elf64_Phdr> (N_PHDRS);
+
+  memset (&ehdr, 0, sizeof (ehdr));
+  memcpy (ehdr.e_ident, ELF::ElfMagic, strlen (ELF::ElfMagic));
+  ehdr.e_ident [ELF::EI_CLASS] = ELF::ELFCLASS64;
+  ehdr.e_ident [ELF::EI_DATA] = ELF::ELFDATA2LSB;
+  ehdr.e_ident [ELF::EI_VERSION] = ELF::EV_CURRENT;
+  ehdr.e_ident [ELF::EI_OSABI] = ELF::ELFOSABI_NONE;
+  ehdr.e_type = ELF::ET_EXEC;
+  ehdr.e_machine = ELF::EM_X86_64;
+  ehdr.e_version = ELF::EV_CURRENT;
+  ehdr.e_entry = entry;
+  ehdr.e_phoff = sizeof (ehdr);
+  ehdr.e_ehsize = sizeof (ehdr);
+  ehdr.e_phentsize = sizeof (ELF::Elf64_Phdr);
+  ehdr.e_phnum = N_PHDRS;
+
+  memset (phdrs.data (), 0, N_PHDRS * sizeof (ELF::Elf64_Phdr));
+  phdrs [0].p_type = ELF::PT_LOAD;
+  phdrs [0].p_flags = ELF::PF_R | ELF::PF_X;
+  phdrs [0].p_offset = 0;
+  phdrs [0].p_vaddr = phdrs [0].p_paddr = BASE;
+  phdrs [0].p_filesz = phdrs [0].p_memsz = bounds [segment_code][1];
+  phdrs [0].p_align = PAGESZ;
+
+  phdrs [1].p_type = ELF::PT_LOAD;
+  phdrs [1].p_flags = ELF::PF_R | ELF::PF_W;
+  phdrs [1].p_offset = bounds [segment_data][0];
+  phdrs [1].p_vaddr = phdrs [1].p_paddr = BASE + bounds [segment_data][0];
+  phdrs [1].p_filesz = bounds [segment_data][1] - bounds [segment_data][0];
+  phdrs [1].p_memsz = bounds [segment_bss][1] - bounds [segment_data][0];
+  phdrs [1].p_align = PAGESZ;
+
+  phdrs [2].p_type = ELF::PT_GNU_STACK;
+  phdrs [2].p_flags = ELF::PF_R | ELF::PF_W;
+
+  memcpy (image.data (), &ehdr, sizeof (ehdr));
+  memcpy (image.data () + sizeof (ehdr), phdrs.data (), N_PHDRS * sizeof (ELF::Elf64_Phdr));
+  output.write (image.data (), image.size ());
+#undef CHECK
+#undef THROW
+}
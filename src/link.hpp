@@ -0,0 +1,38 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_LINK__
+#define __BFC_LINK__ 1
+#include <bfc.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/raw_ostream.h>
+
+namespace Bfc
+{
+  /*
+   * Links an object (as emitted for BfcOptions::link, see
+   * BfcState::freestanding) into a static executable, written
+   * out to output. Only x86-64 ELF objects are taken, and only
+   * the relocations code generation emits for them: the object
+   * has to define every symbol it uses, the entry point (_start)
+   * included, as there is nothing to link it against
+   *
+   */
+  void link (llvm::StringRef object, llvm::raw_ostream& output, GError** error);
+}
+
+#endif // __BFC_LINK__
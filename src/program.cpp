@@ -0,0 +1,1127 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <map>
+#include <program.hpp>
+#include <string.h>
+
+using namespace Bfc;
+
+G_DEFINE_QUARK (bfc-program-error-quark, bfc_program_error);
+#define BFC_PROGRAM_ERROR (bfc_program_error_quark ())
+#define BFC_PROGRAM_ERROR_FAILED (0)
+
+/*
+ * Default belt sizes (in cells), for when the program can not
+ * be sized by itself; a lazy belt only commits the pages it
+ * touches, so it can be made much larger for free
+ *
+ */
+static const gsize BELTSZ = 1024;
+static const gsize LAZY_BELTSZ = 1 << 28;
+
+/*
+ * Appends an operation, merging it with the previous one
+ * when both are of the same foldable kind (so '+-+-' or '><'
+ * vanish entirely, and '+++' becomes a single add)
+ *
+ */
+inline void
+Program::fold (OpCode code, gint64 value)
+{
+  if (!ops.empty () && ops.back ().code == code)
+  {
+    auto& last = ops.back ();
+    if ((last.value += value) == 0)
+      ops.pop_back ();
+  }
+  else
+  {
+    ops.push_back (Op { code, 0, value, 0 });
+  }
+}
+
+/*
+ * Sources are scanned a block at a time for bytes which may
+ * matter (commands, and printable characters in strict mode),
+ * so comments are skipped in bulk; with vector extensions at
+ * hand, blocks are classified with a handful of compares
+ *
+ */
+static const gsize BLOCKSZ = 16;
+
+#if defined (__GNUC__)
+typedef guint8 Block __attribute__ ((vector_size (BLOCKSZ)));
+#endif // __GNUC__
+
+static inline gboolean
+quiet (const gchar* ptr, gboolean strict)
+{
+#if defined (__GNUC__)
+  Block block;
+  guint64 words [2];
+
+  memcpy (&block, ptr, sizeof (block));
+
+  auto hits = (block == '<') | (block == '>') | (block == '+') | (block == '-')
+            | (block == ',') | (block == '.') | (block == '[') | (block == ']');
+
+  if (strict)
+    hits |= (block > ' ') & (block != 0x7f);
+
+  memcpy (words, &hits, sizeof (words));
+return (words [0] | words [1]) == 0;
+#else // !__GNUC__
+  for (gsize i = 0; i < BLOCKSZ; ++i)
+  {
+    auto c = (guint8) ptr [i];
+
+    if (strchr ("<>+-,.[]", c) != nullptr && c != 0)
+      return FALSE;
+    if (strict && c > ' ' && c != 0x7f)
+      return FALSE;
+  }
+return TRUE;
+#endif // __GNUC__
+}
+
+/*
+ * Regular files are mapped rather than read; anything else
+ * (standard input, pipes) is read whole into memory
+ *
+ */
+static GBytes*
+load (BfcStream* input, GError** error)
+{
+  auto stream = (GInputStream*) input->istream;
+  auto tmperr = (GError*) nullptr;
+
+  if (g_strcmp0 (input->filename, "-") != 0
+    && g_file_test (input->filename, G_FILE_TEST_IS_REGULAR))
+  {
+    auto mapped = g_mapped_file_new (input->filename, FALSE, &tmperr);
+
+    if (G_UNLIKELY (tmperr != nullptr))
+    {
+      g_propagate_error (error, tmperr);
+      return nullptr;
+    }
+
+    auto bytes = g_mapped_file_get_bytes (mapped);
+      g_mapped_file_unref (mapped);
+    return bytes;
+  }
+  else
+  {
+    auto array = g_byte_array_new ();
+    auto got = (gssize) 0;
+
+    do
+    {
+      auto size = array->len;
+
+      g_byte_array_set_size (array, size + 65536);
+      got = g_input_stream_read (stream, array->data + size, 65536, nullptr, &tmperr);
+      g_byte_array_set_size (array, size + MAX (got, 0));
+
+      if (G_UNLIKELY (tmperr != nullptr))
+      {
+        g_propagate_error (error, tmperr);
+        g_byte_array_unref (array);
+        return nullptr;
+      }
+    }
+    while (got > 0);
+  return g_byte_array_free_to_bytes (array);
+  }
+}
+
+/*
+ * Positions are only worked out for error messages: lines
+ * are counted up to ptr, columns in characters from the
+ * start of its line
+ *
+ */
+static void
+locate (const gchar* data, const gchar* ptr, guint* n_line, guint* n_column)
+{
+  auto line = data;
+
+  *n_line = 1;
+  *n_column = 1;
+
+  for (auto p = data; p < ptr; ++p)
+  if (*p == '\n')
+  {
+    line = p + 1;
+    ++*n_line;
+  }
+
+  for (auto p = line; p < ptr; ++p)
+  if ((*p & 0xc0) != 0x80)
+    ++*n_column;
+}
+
+void
+Program::parse (BfcOptions* opt, BfcStream* input, GError** error)
+{
+  auto tmperr = (GError*) nullptr;
+  auto bytes = load (input, &tmperr);
+
+  if (G_UNLIKELY (tmperr != nullptr))
+    g_propagate_error (error, tmperr);
+  else
+  {
+    gsize length;
+    auto data = (const gchar*) g_bytes_get_data (bytes, &length);
+
+    lex (opt, input->filename, data, length, error);
+    g_bytes_unref (bytes);
+  }
+}
+
+void
+Program::lex (BfcOptions* opt, const gchar* filename, const gchar* data, gsize length, GError** error)
+{
+  std::vector<std::pair<gsize, const gchar*>> opens;
+  auto ptr = data;
+  auto top = data + length;
+  guint n_line, n_column;
+
+  while (ptr < top)
+  {
+    if ((gsize) (top - ptr) >= BLOCKSZ && quiet (ptr, opt->strict))
+    {
+      ptr += BLOCKSZ;
+      continue;
+    }
+
+    switch (*ptr)
+    {
+      case '<':
+        fold (op_move, -1);
+        break;
+      case '>':
+        fold (op_move, 1);
+        break;
+      case '-':
+        fold (op_add, -1);
+        break;
+      case '+':
+        fold (op_add, 1);
+        break;
+
+      case ',':
+        ops.push_back (Op { op_read, 0, 0, 0 });
+        break;
+      case '.':
+        ops.push_back (Op { op_write, 0, 1, 0 });
+        break;
+
+      /*
+       * Open loops remember where they are in the source,
+       * should they be left unmatched
+       *
+       */
+      case '[':
+        opens.push_back (std::make_pair (ops.size (), ptr));
+        ops.push_back (Op { op_open, 0, 0, 0 });
+        break;
+      case ']':
+        if (opens.empty ())
+        {
+          locate (data, ptr, &n_line, &n_column);
+          g_set_error
+          (error,
+          BFC_PROGRAM_ERROR,
+          BFC_PROGRAM_ERROR_FAILED,
+          "%s: %i: %i: Unmatched ']' token",
+            filename, n_line, n_column);
+          return;
+        }
+        else
+        {
+          auto open = opens.back ().first;
+            opens.pop_back ();
+
+          ops [open].jump = ops.size ();
+          ops.push_back (Op { op_close, 0, 0, open });
+        }
+        break;
+
+      default:
+        if (opt->strict)
+        {
+          /*
+           * Input is not NUL-terminated, so characters are
+           * decoded no further than top; bytes which do not start
+           * a (complete) valid sequence are reported on their own
+           *
+           */
+          auto c = g_utf8_get_char_validated (ptr, top - ptr);
+          auto valid = (gint32) c >= 0;
+          auto next = (valid) ? MIN (g_utf8_next_char (ptr), top) : ptr + 1;
+
+          if (!valid || !(g_unichar_iscntrl (c) || g_unichar_isspace (c)))
+          {
+            locate (data, ptr, &n_line, &n_column);
+            g_set_error
+            (error,
+            BFC_PROGRAM_ERROR,
+            BFC_PROGRAM_ERROR_FAILED,
+            "%s: %i: %i: Unknown character '%.*s'",
+              filename, n_line, n_column,
+              (gint) (next - ptr), ptr);
+            return;
+          }
+
+          ptr = next;
+          continue;
+        }
+        break;
+    }
+
+    ++ptr;
+  }
+
+  if (G_UNLIKELY (!opens.empty ()))
+  {
+    locate (data, opens.back ().second, &n_line, &n_column);
+    g_set_error
+    (error,
+    BFC_PROGRAM_ERROR,
+    BFC_PROGRAM_ERROR_FAILED,
+    "%s: %i: %i: Unmatched '[' token",
+      filename, n_line, n_column);
+    return;
+  }
+}
+
+/*
+ * Cell values wrap around at the cell width
+ *
+ */
+static inline guint64
+cellmask (BfcOptions* opt)
+{
+  if (opt->cellbits >= 64)
+    return G_MAXUINT64;
+  else
+    return (G_GUINT64_CONSTANT (1) << opt->cellbits) - 1;
+}
+
+/*
+ * Appends an operation to a rewritten op list, merging
+ * it with the previous one when both touch the same cell
+ * (a set followed by an add becomes a single set, an add
+ * followed by a set is overwritten), or when both are writes
+ * of consecutive cells (as in '.>.>.')
+ *
+ */
+static inline void
+emit (std::vector<Op>& out, const Op& op)
+{
+  if (!out.empty ())
+  {
+    auto& last = out.back ();
+
+    switch (op.code)
+    {
+      case op_move:
+        if (last.code == op_move)
+        {
+          if ((last.value += op.value) == 0)
+            out.pop_back ();
+          return;
+        }
+        break;
+      case op_add:
+        if (last.offset == op.offset)
+        {
+          if (last.code == op_set)
+          {
+            last.value += op.value;
+            return;
+          }
+          else if (last.code == op_add)
+          {
+            if ((last.value += op.value) == 0)
+              out.pop_back ();
+            return;
+          }
+        }
+        break;
+      case op_set:
+        if (last.offset == op.offset)
+        {
+          if (last.code == op_set || last.code == op_add)
+          {
+            last = op;
+            return;
+          }
+        }
+        break;
+      case op_write:
+        if (last.code == op_write && last.offset + last.value == op.offset)
+        {
+          last.value += op.value;
+          return;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  out.push_back (op);
+}
+
+/*
+ * Is the cell at offset (from the cursor) known to be zero
+ * at the end of out? (program start, right after a loop,
+ * or after a clear)
+ *
+ */
+static inline gboolean
+zeroed (std::vector<Op>& out, gint64 offset)
+{
+  if (out.empty ())
+    return TRUE;
+  else
+  {
+    auto& last = out.back ();
+    return (last.code == op_close && offset == 0)
+        || (last.code == op_set && last.offset == offset && last.value == 0);
+  }
+}
+
+/*
+ * Recognizes a loop body (everything past out [open]) made
+ * only of adds, which decrements (or increments) its control
+ * cell by one on each iteration, and fills repl with the
+ * equivalent straight-line multiplications: [-] and [+] become
+ * cell = 0, while [->+<] and its kin become cell [k] += c * cell,
+ * cell = 0. A body made of a single move, as in [>] or [<<<<],
+ * becomes a zero scan
+ *
+ */
+static gboolean
+idiom (std::vector<Op>& out, gsize open, std::vector<Op>& repl)
+{
+  std::vector<std::pair<gint, gint64>> deltas;
+  gint64 step = 0;
+
+  if (out.size () == open + 2 && out.back ().code == op_move)
+  {
+    auto stride = out.back ().value;
+    if (stride >= G_MININT && stride <= G_MAXINT)
+    {
+      repl.push_back (Op { op_scan, 0, stride, 0 });
+      return TRUE;
+    }
+  }
+
+  for (gsize i = open + 1; i < out.size (); ++i)
+  {
+    auto& op = out [i];
+
+    if (op.code != op_add)
+      return FALSE;
+    else if (op.offset == 0)
+      step += op.value;
+    else
+    {
+      gboolean found = FALSE;
+
+      for (auto& delta : deltas)
+      if (delta.first == op.offset)
+      {
+        delta.second += op.value;
+        found = TRUE;
+        break;
+      }
+
+      if (!found)
+        deltas.push_back (std::make_pair (op.offset, op.value));
+    }
+  }
+
+  if (step != 1 && step != -1)
+    return FALSE;
+  else
+  {
+    for (auto& delta : deltas)
+    if (delta.second != 0)
+      repl.push_back (Op { op_mul, delta.first, - delta.second * step, 0 });
+
+    repl.push_back (Op { op_set, 0, 0, 0 });
+    return TRUE;
+  }
+}
+
+void
+Program::simplify (BfcOptions* opt)
+{
+  std::vector<std::pair<gsize, gint64>> opens;
+  std::vector<Op> repl;
+  std::vector<Op> out;
+  gint64 pending = 0;
+
+  out.reserve (ops.size ());
+
+  /*
+   * Cursor movement is deferred into the offsets of the
+   * following operations, and only committed (as a single
+   * op_move) where the cursor itself matters: loop boundaries
+   * and scans
+   *
+   */
+#define COMMIT() \
+  G_STMT_START { \
+    if (pending != 0) \
+    { \
+      out.push_back (Op { op_move, 0, pending, 0 }); \
+      pending = 0; \
+    } \
+  } G_STMT_END
+
+  for (gsize i = 0; i < ops.size (); ++i)
+  {
+    auto op = ops [i];
+
+    switch (op.code)
+    {
+      case op_move:
+        pending += op.value;
+        if (pending < G_MININT / 2 || pending > G_MAXINT / 2)
+          COMMIT ();
+        break;
+
+      case op_open:
+        if (zeroed (out, pending))
+          i = op.jump;
+        else
+        {
+          opens.push_back (std::make_pair (out.size () + (pending != 0), pending));
+          COMMIT ();
+          out.push_back (op);
+        }
+        break;
+      case op_close:
+        {
+          auto open = opens.back ().first;
+          auto moved = opens.back ().second;
+            opens.pop_back ();
+
+          COMMIT ();
+          repl.clear ();
+
+          if (!idiom (out, open, repl))
+          {
+            out [open].jump = out.size ();
+            out.push_back (Op { op_close, 0, 0, open });
+          }
+          else if (repl.front ().code == op_scan)
+          {
+            out.resize (open);
+            out.push_back (repl.front ());
+          }
+          else
+          {
+            /*
+             * The loop is gone, so the move committed on entering it
+             * is deferred again
+             *
+             */
+            out.resize (open);
+
+            if (moved != 0)
+            {
+              out.pop_back ();
+              pending = moved;
+            }
+
+            for (auto& op : repl)
+            {
+              op.offset += pending;
+              op.source += pending;
+              emit (out, op);
+            }
+          }
+        }
+        break;
+
+      default:
+        op.offset += pending;
+        emit (out, op);
+        break;
+    }
+  }
+
+#undef COMMIT
+  ops.swap (out);
+}
+
+/*
+ * Computes the range of cells (relative to the cursor at
+ * ops [first]) which ops [first, last) may touch, along with
+ * the net cursor movement across them. Fails if the cursor
+ * can end up anywhere: after a scan, or after a loop which
+ * does not bring the cursor back to where it entered it
+ *
+ */
+gboolean
+Program::extent (gsize first, gsize last, gint64* lo, gint64* hi, gint64* moved) const
+{
+  gint64 pos = 0;
+
+  *lo = 0;
+  *hi = 0;
+
+#define TOUCH(offset) \
+  G_STMT_START { \
+    gint64 __at = pos + (offset); \
+    *lo = MIN (*lo, __at); \
+    *hi = MAX (*hi, __at); \
+  } G_STMT_END
+
+  for (gsize i = first; i < last; ++i)
+  {
+    auto& op = ops [i];
+
+    switch (op.code)
+    {
+      case op_move:
+        pos += op.value;
+        break;
+      case op_add:
+      case op_set:
+      case op_read:
+        TOUCH (op.offset);
+        break;
+      case op_mul:
+        TOUCH (op.offset);
+        TOUCH (op.source);
+        break;
+      case op_write:
+        TOUCH (op.offset);
+        TOUCH (op.offset + op.value - 1);
+        break;
+      case op_print:
+        break;
+      case op_scan:
+        return FALSE;
+
+      case op_open:
+        {
+          gint64 inlo, inhi, inmoved;
+
+          if (!extent (i + 1, op.jump, &inlo, &inhi, &inmoved) || inmoved != 0)
+            return FALSE;
+
+          TOUCH (0);
+          TOUCH (inlo);
+          TOUCH (inhi);
+          i = op.jump;
+        }
+        break;
+      case op_close:
+        g_assert_not_reached ();
+        break;
+    }
+  }
+
+#undef TOUCH
+  *moved = pos;
+  return TRUE;
+}
+
+/*
+ * Tests whether ops [first, last) do nothing but update cells
+ * and move the cursor: no I/O, loops nor scans, so every cell
+ * in their extent is touched, and nothing else seen, whenever
+ * they run
+ *
+ */
+gboolean
+Program::plain (gsize first, gsize last) const
+{
+  for (gsize i = first; i < last; ++i)
+  {
+    switch (ops [i].code)
+    {
+      case op_move:
+      case op_add:
+      case op_set:
+      case op_mul:
+        break;
+      default:
+        return FALSE;
+    }
+  }
+return TRUE;
+}
+
+/*
+ * Sizes the belt: as given by opt->beltsz or, when that is
+ * zero, just large enough for every cell the program may touch
+ * (falling back to a default when that can not be told), then
+ * rounded up to a power of two if it wraps around
+ *
+ */
+void
+Program::measure (BfcOptions* opt)
+{
+  gint64 lo, hi, moved;
+
+  if (opt->beltsz > 0)
+    beltsz = opt->beltsz;
+  else if (extent (0, ops.size (), &lo, &hi, &moved) && lo >= 0)
+    beltsz = (gsize) hi + 1;
+  else
+    beltsz = (opt->lazybelt) ? LAZY_BELTSZ : BELTSZ;
+
+  if (opt->beltwrap)
+  {
+    gsize size = 1;
+
+    while (size < beltsz)
+      size <<= 1;
+    beltsz = size;
+  }
+}
+
+/*
+ * Runs the program at compile time until it asks for input,
+ * goes out of the belt or exhausts opt->evalsteps, and keeps
+ * only what is left to run, along with the state reached in
+ * initial. Execution can only be resumed outside any loop, so
+ * stopping inside one rolls back to the point where its
+ * outermost enclosing loop was entered
+ *
+ */
+void
+Program::evaluate (BfcOptions* opt)
+{
+  const guint64 mask = cellmask (opt);
+  std::vector<guint64> cells;
+  std::string output;
+  gsize cursor = 0, top = 0;
+  gsize steps = 0, depth = 0;
+  gboolean stop = FALSE;
+  gsize i = 0;
+
+  Snapshot saved;
+  gsize resume = 0;
+  gsize written = 0;
+
+  auto cell = [&] (gint64 offset) -> guint64*
+  {
+    gint64 index = (gint64) cursor + offset;
+
+    if (opt->beltwrap)
+      index &= (gint64) beltsz - 1;
+    if (index < 0 || (guint64) index >= beltsz)
+      return (stop = TRUE, nullptr);
+
+    /*
+     * Cells are kept (and emitted into initial) up to the
+     * farthest one reached, which a single move can take
+     * anywhere on a huge belt: no further than the step budget
+     * goes then, leaving the rest to run time
+     *
+     */
+    if ((guint64) index >= opt->evalsteps)
+      return (stop = TRUE, nullptr);
+    if ((gsize) index >= cells.size ())
+      cells.resize (MAX ((gsize) index + 1, 2 * cells.size ()), 0);
+
+    top = MAX (top, (gsize) index + 1);
+    return & cells [index];
+  };
+
+  if (opt->evalsteps == 0 || opt->olevel == 0)
+    return;
+
+  while (i < ops.size () && !stop)
+  {
+    auto& op = ops [i];
+    guint64* at;
+
+    if (++steps > opt->evalsteps)
+      break;
+
+    switch (op.code)
+    {
+      case op_move:
+        if (opt->beltwrap)
+          cursor = (cursor + op.value) & (beltsz - 1);
+        else if ((gint64) cursor + op.value < 0)
+          stop = TRUE;
+        else
+          cursor += op.value;
+        break;
+      case op_add:
+        if ((at = cell (op.offset)) != nullptr)
+          *at = (*at + op.value) & mask;
+        break;
+      case op_set:
+        if ((at = cell (op.offset)) != nullptr)
+          *at = op.value & mask;
+        break;
+      case op_mul:
+        if ((at = cell (op.source)) != nullptr)
+        {
+          auto source = *at;
+          if ((at = cell (op.offset)) != nullptr)
+            *at = (*at + source * op.value) & mask;
+        }
+        break;
+      case op_scan:
+        {
+          auto start = cursor;
+
+          while ((at = cell (0)) != nullptr && *at != 0)
+          {
+            if (++steps > opt->evalsteps)
+            {
+              stop = TRUE;
+              break;
+            }
+
+            cursor += op.value;
+
+            if (opt->beltwrap)
+              cursor &= beltsz - 1;
+          }
+
+          if (stop)
+            cursor = start;
+        }
+        break;
+
+      case op_read:
+        stop = TRUE;
+        break;
+      case op_write:
+        {
+          auto size = output.size ();
+
+          for (gint64 j = 0; j < op.value && !stop; ++j)
+          if ((at = cell (op.offset + j)) != nullptr)
+            output.push_back ((gchar) *at);
+
+          /*
+           * The whole op runs again at runtime, so
+           * none of its bytes are written out here
+           *
+           */
+          if (stop)
+            output.resize (size);
+        }
+        break;
+      case op_print:
+        output.append (strings [op.value]);
+        break;
+
+      case op_open:
+        if (depth == 0)
+        {
+          /*
+           * Entering a top-level loop: remember this state, as it
+           * is the one execution resumes from if evaluation stops
+           * before leaving the loop (copying the belt counts
+           * against the budget as well)
+           *
+           */
+          saved.cells.assign (cells.begin (), cells.begin () + top);
+          saved.cursor = cursor;
+          written = output.size ();
+          steps += top / 16;
+        }
+
+        if ((at = cell (0)) == nullptr)
+          break;
+        else if (*at == 0)
+        {
+          i = op.jump;
+          break;
+        }
+        ++depth;
+        break;
+      case op_close:
+        if ((at = cell (0)) == nullptr)
+          break;
+        else if (*at != 0)
+        {
+          i = op.jump;
+          break;
+        }
+        --depth;
+        break;
+    }
+
+    if (!stop)
+    {
+      if (++i, depth == 0)
+        resume = i;
+    }
+  }
+
+  if (resume > 0)
+  {
+    if (depth == 0)
+    {
+      saved.cells.assign (cells.begin (), cells.begin () + top);
+      saved.cursor = cursor;
+      written = output.size ();
+    }
+
+    while (!saved.cells.empty () && saved.cells.back () == 0)
+      saved.cells.pop_back ();
+
+    initial.cells.swap (saved.cells);
+    initial.output.assign (output, 0, written);
+    initial.cursor = saved.cursor;
+
+    ops.erase (ops.begin (), ops.begin () + resume);
+
+    for (auto& op : ops)
+    if (op.code == op_open || op.code == op_close)
+      op.jump -= resume;
+  }
+}
+
+/*
+ * Tracks the cell values known at compile time through
+ * straight-line code (the whole belt at the start, only the
+ * cell under the cursor right after a loop or a scan): ops on
+ * known cells fold into plain sets, loops over a known zero
+ * cell are dropped, and writes of known cells are gathered
+ * into constant strings, each one printed by a single op_print
+ *
+ */
+void
+Program::propagate (BfcOptions* opt)
+{
+  const guint64 mask = cellmask (opt);
+  std::map<gint64, std::pair<gboolean, guint64>> known;
+  std::vector<gsize> opens;
+  std::vector<Op> out;
+  gboolean fresh = TRUE;
+  gint64 base = 0;
+  gssize text = -1;
+
+  /*
+   * Cells are keyed by their position relative to base, which
+   * follows the cursor (wrapped around the belt if it does so);
+   * when fresh, cells missing from known are zero (otherwise
+   * they are unknown)
+   *
+   */
+  auto key = [&] (gint64 offset) -> gint64
+  {
+    if (!opt->beltwrap)
+      return base + offset;
+    else
+      return (base + offset) & ((gint64) beltsz - 1);
+  };
+
+  auto lookup = [&] (gint64 offset, guint64* value) -> gboolean
+  {
+    auto found = known.find (key (offset));
+
+    if (found != known.end ())
+      return (*value = found->second.second, found->second.first);
+    /*
+     * While fresh, base is where the cursor really is, so
+     * cells off the belt can be told apart; those must be
+     * left for the check to trap on, not taken for zeros
+     *
+     */
+    else if (fresh && opt->checkbelt && !opt->beltwrap
+      && (key (offset) < 0 || key (offset) >= (gint64) beltsz))
+      return (*value = 0, FALSE);
+    else
+      return (*value = 0, fresh);
+  };
+
+  auto learn = [&] (gint64 offset, guint64 value)
+  {
+    known [key (offset)] = std::make_pair (TRUE, value);
+  };
+
+  auto lose = [&] (gint64 offset)
+  {
+    known [key (offset)] = std::make_pair (FALSE, (guint64) 0);
+  };
+
+  auto forget = [&] ()
+  {
+    known.clear ();
+    fresh = FALSE;
+    text = -1;
+  };
+
+  if (opt->olevel == 0)
+    return;
+
+  base = (gint64) initial.cursor;
+  out.reserve (ops.size ());
+
+  for (gsize i = 0; i < initial.cells.size (); ++i)
+    known [i] = std::make_pair (TRUE, initial.cells [i]);
+
+  for (gsize i = 0; i < ops.size (); ++i)
+  {
+    auto op = ops [i];
+    auto emitted = out.size ();
+    guint64 value, source;
+
+    switch (op.code)
+    {
+      case op_move:
+        base += op.value;
+        emit (out, op);
+        break;
+      case op_add:
+        if (!lookup (op.offset, &value))
+          emit (out, op);
+        else
+        {
+          op.code = op_set;
+          op.value = (value + op.value) & mask;
+          goto set;
+        }
+        break;
+      case op_mul:
+        if (!lookup (op.source, &source))
+        {
+          lose (op.offset);
+          emit (out, op);
+        }
+        else if (((source * op.value) & mask) != 0)
+        {
+          auto delta = (source * op.value) & mask;
+
+          if (!lookup (op.offset, &value))
+          {
+            op.code = op_add;
+            op.value = delta;
+            emit (out, op);
+          }
+          else
+          {
+            op.code = op_set;
+            op.value = (value + delta) & mask;
+            goto set;
+          }
+        }
+        break;
+      case op_set:
+        op.value &= mask;
+      set:
+        if (!lookup (op.offset, &value) || value != (guint64) op.value)
+        {
+          learn (op.offset, op.value);
+          emit (out, op);
+        }
+        break;
+      case op_scan:
+        forget ();
+        learn (0, 0);
+        emit (out, op);
+        break;
+
+      case op_read:
+        lose (op.offset);
+        text = -1;
+        emit (out, op);
+        break;
+      case op_write:
+        {
+          std::string chars;
+
+          for (gint64 j = 0; j < op.value; ++j)
+          if (lookup (op.offset + j, &value))
+            chars.push_back ((gchar) value);
+          else
+            break;
+
+          if ((gint64) chars.size () < op.value)
+          {
+            text = -1;
+            emit (out, op);
+          }
+          else if (text >= 0)
+            strings [out [text].value].append (chars);
+          else
+          {
+            /*
+             * Output is only moved up across straight-line ops
+             * which neither read nor write, so it is still seen
+             * in the same order
+             *
+             */
+            text = out.size ();
+            out.push_back (Op { op_print, 0, (gint64) strings.size (), 0 });
+            strings.push_back (chars);
+          }
+        }
+        break;
+      case op_print:
+        text = -1;
+        out.push_back (op);
+        break;
+
+      case op_open:
+        if (lookup (0, &value) && value == 0)
+          i = op.jump;
+        else
+        {
+          forget ();
+          opens.push_back (out.size ());
+          out.push_back (op);
+        }
+        break;
+      case op_close:
+        {
+          auto open = opens.back ();
+            opens.pop_back ();
+
+          forget ();
+          learn (0, 0);
+          out [open].jump = out.size ();
+          out.push_back (Op { op_close, 0, 0, open });
+        }
+        break;
+    }
+
+    /*
+     * With the belt checked, any op touching a cell may trap,
+     * and output moved up above it would be seen nonetheless
+     *
+     */
+    if (opt->checkbelt)
+    for (auto j = emitted; j < out.size (); ++j)
+    if (out [j].code != op_move && out [j].code != op_print)
+      text = -1;
+  }
+
+  ops.swap (out);
+}
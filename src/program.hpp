@@ -0,0 +1,91 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_PROGRAM__
+#define __BFC_PROGRAM__ 1
+#include <bfc.h>
+#include <string>
+#include <vector>
+
+namespace Bfc
+{
+  enum OpCode
+  {
+    op_add,       /* cell [offset] += value */
+    op_move,      /* cursor += value */
+    op_open,      /* while (cell) {, jump points to matching op_close */
+    op_close,     /* }, jump points to matching op_open */
+    op_read,      /* cell [offset] = getchar () */
+    op_write,     /* putchar (cell [offset]), ... up to cell [offset + value - 1] */
+    op_set,       /* cell [offset] = value */
+    op_mul,       /* cell [offset] += cell [source] * value */
+    op_scan,      /* while (cell) cursor += value */
+    op_print,     /* fputs (strings [value]) */
+  };
+
+  /*
+   * Cells are addressed relative to the cursor, which only
+   * moves on op_move and op_scan (simplify defers every other
+   * movement into the offsets of the following operations)
+   *
+   */
+  struct Op
+  {
+    OpCode code;
+    gint offset;
+    gint64 value;
+    gsize jump;
+    gint source;
+  };
+
+  /*
+   * Machine state in which ops start running: the belt
+   * contents (from cell 0 on, the rest is zero), the cursor
+   * position and the output already produced; all of them are
+   * empty unless a prefix of the program was evaluated at
+   * compile time
+   *
+   */
+  struct Snapshot
+  {
+    std::vector<guint64> cells;
+    std::string output;
+    gsize cursor;
+  };
+
+  class Program
+  {
+  public:
+    void parse (BfcOptions* opt, BfcStream* input, GError** error);
+    void simplify (BfcOptions* opt);
+    void measure (BfcOptions* opt);
+    void evaluate (BfcOptions* opt);
+    void propagate (BfcOptions* opt);
+    gboolean extent (gsize first, gsize last, gint64* lo, gint64* hi, gint64* moved) const;
+    gboolean plain (gsize first, gsize last) const;
+
+    std::vector<Op> ops;
+    std::vector<std::string> strings;
+    Snapshot initial;
+    gsize beltsz;
+  private:
+    inline void fold (OpCode code, gint64 value);
+    void lex (BfcOptions* opt, const gchar* filename, const gchar* data, gsize length, GError** error);
+  };
+}
+
+#endif // __BFC_PROGRAM__
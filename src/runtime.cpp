@@ -0,0 +1,91 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <runtime.hpp>
+#include <string.h>
+#include <unistd.h>
+
+using namespace Bfc;
+
+guint8 Runtime::in [BUFFERSZ];
+gintptr Runtime::inlen = 0;
+gintptr Runtime::inpos = 0;
+guint8 Runtime::out [BUFFERSZ];
+gintptr Runtime::outlen = 0;
+
+/*
+ * Writes a whole span into the standard output, going on
+ * after short writes
+ *
+ */
+static gint32
+drain (const guint8* ptr, gintptr length)
+{
+  while (length > 0)
+  {
+    auto wrote = write (1, ptr, length);
+    if (wrote <= 0)
+      return -1;
+
+    ptr += wrote;
+    length -= wrote;
+  }
+  return 0;
+}
+
+gint32
+Runtime::flush ()
+{
+  auto length = outlen;
+
+  outlen = 0;
+  return drain (out, length);
+}
+
+gintptr
+Runtime::fill ()
+{
+  if (flush () < 0)
+    return -1;
+
+  auto got = read (0, in, BUFFERSZ);
+
+  inpos = 0;
+  inlen = MAX (got, 0);
+  return got;
+}
+
+gint32
+Runtime::puts (const guint8* ptr, gintptr length)
+{
+  if (length <= BUFFERSZ - outlen)
+  {
+    memcpy (out + outlen, ptr, length);
+    outlen += length;
+    return 0;
+  }
+
+  if (flush () < 0)
+    return -1;
+  if (length > BUFFERSZ)
+    return drain (ptr, length);
+
+  memcpy (out, ptr, length);
+  outlen = length;
+  return 0;
+}
@@ -0,0 +1,60 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_RUNTIME__
+#define __BFC_RUNTIME__ 1
+#include <bfc.h>
+
+/*
+ * Scan loops read the belt in aligned chunks of this size
+ * (in bytes), so the belt allocation is padded by as much
+ * on both ends to keep every such read in bounds
+ *
+ */
+static const guint CHUNKSZ = 16;
+
+/*
+ * Size (in bytes) of the input and output buffers kept by
+ * the I/O runtime (see BfcState::runtime)
+ *
+ */
+static const guint BUFFERSZ = 65536;
+
+namespace Bfc
+{
+  /*
+   * The I/O runtime hosted by bfc itself, for programs run in
+   * process while interpreting (see Bfc::Interpreter): compiled
+   * code reaches these instead of a runtime of its own (see
+   * BfcState::import), so both tiers share the same buffers.
+   * Layout and behaviour are those of BfcState::runtime
+   *
+   */
+  namespace Runtime
+  {
+    extern guint8 in [BUFFERSZ];
+    extern gintptr inlen, inpos;
+    extern guint8 out [BUFFERSZ];
+    extern gintptr outlen;
+
+    gint32 flush ();
+    gintptr fill ();
+    gint32 puts (const guint8* ptr, gintptr length);
+  }
+}
+
+#endif // __BFC_RUNTIME__
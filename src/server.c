@@ -0,0 +1,340 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <config.h>
+#include <errno.h>
+#include <gio/gio.h>
+#include <server.h>
+
+#ifdef G_OS_UNIX
+# include <gio/gunixconnection.h>
+# include <glib/gstdio.h>
+# include <stdio.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#endif // G_OS_UNIX
+
+#define _g_free0(var) ((var == NULL) ? NULL : (var = (g_free (var), NULL)))
+
+#define BFC_SERVER_ERROR (bfc_server_error_quark ())
+#define BFC_SERVER_ERROR_FAILED (0)
+G_DEFINE_QUARK (bfc-server-error-quark, bfc_server_error);
+
+/*
+ * Requests are the client's standard streams (passed as
+ * descriptors), followed by its working directory and
+ * arguments, every string prefixed by its length. The
+ * reply is the exit status of the compilation
+ *
+ */
+#define MAXARGS (65536)
+#define MAXSTRING (1 << 20)
+#define NSTDIO (3)
+
+#define THROW(...) \
+  G_STMT_START { \
+    g_set_error \
+    (error, \
+     BFC_SERVER_ERROR, \
+     BFC_SERVER_ERROR_FAILED, \
+      __VA_ARGS__); \
+    return; \
+  } G_STMT_END
+
+gchar*
+server_socket (void)
+{
+return g_build_filename (g_get_user_runtime_dir (), "bfc.socket", NULL);
+}
+
+#ifdef G_OS_UNIX
+
+static gchar*
+_read_string (GDataInputStream* stream, GError** error)
+{
+  GError* tmperr = NULL;
+  gchar* string = NULL;
+  guint32 length;
+
+  length = g_data_input_stream_read_uint32 (stream, NULL, &tmperr);
+
+  if (G_UNLIKELY (tmperr != NULL))
+    g_propagate_error (error, tmperr);
+  else
+  if (length > MAXSTRING)
+    g_set_error
+    (error,
+     BFC_SERVER_ERROR,
+     BFC_SERVER_ERROR_FAILED,
+     "Request string too long (%u bytes)",
+      length);
+  else
+  {
+    string = g_malloc (length + 1);
+    string [length] = 0;
+
+    if (!g_input_stream_read_all (G_INPUT_STREAM (stream), string, length, NULL, NULL, &tmperr))
+    {
+      g_propagate_error (error, tmperr);
+      _g_free0 (string);
+    }
+  }
+return string;
+}
+
+static void
+_write_string (GDataOutputStream* stream, const gchar* string, GError** error)
+{
+  GError* tmperr = NULL;
+
+  g_data_output_stream_put_uint32 (stream, strlen (string), NULL, &tmperr);
+  if (G_LIKELY (tmperr == NULL))
+    g_data_output_stream_put_string (stream, string, NULL, &tmperr);
+  if (G_UNLIKELY (tmperr != NULL))
+    g_propagate_error (error, tmperr);
+}
+
+static void
+_serve (GSocketConnection* connection, ServerMain main_, GError** error)
+{
+  GInputStream* input = g_io_stream_get_input_stream (G_IO_STREAM (connection));
+  GOutputStream* output = g_io_stream_get_output_stream (G_IO_STREAM (connection));
+  GDataInputStream* request = g_data_input_stream_new (input);
+  GDataOutputStream* reply = g_data_output_stream_new (output);
+  GError* tmperr = NULL;
+  gchar** argv = NULL;
+  gchar* cwd = NULL;
+  gint fds [NSTDIO];
+  guint32 i, argc = 0;
+  gint status;
+
+  g_filter_input_stream_set_close_base_stream (G_FILTER_INPUT_STREAM (request), FALSE);
+  g_filter_output_stream_set_close_base_stream (G_FILTER_OUTPUT_STREAM (reply), FALSE);
+
+  for (i = 0; i < NSTDIO; i++)
+  {
+    fds [i] = g_unix_connection_receive_fd (G_UNIX_CONNECTION (connection), NULL, &tmperr);
+    if (G_UNLIKELY (tmperr != NULL))
+      goto done;
+  }
+
+  if ((cwd = _read_string (request, &tmperr)) == NULL)
+    goto done;
+
+  argc = g_data_input_stream_read_uint32 (request, NULL, &tmperr);
+  if (G_UNLIKELY (tmperr != NULL))
+    goto done;
+  if (argc == 0 || argc > MAXARGS)
+  {
+    g_set_error (&tmperr, BFC_SERVER_ERROR, BFC_SERVER_ERROR_FAILED, "Invalid argument count %u", argc);
+    goto done;
+  }
+
+  argv = g_new0 (gchar*, argc + 1);
+
+  for (i = 0; i < argc; i++)
+  if ((argv [i] = _read_string (request, &tmperr)) == NULL)
+    goto done;
+
+  /*
+   * From here on this process is the client's
+   * compiler: its streams, its working directory
+   *
+   */
+  for (i = 0; i < NSTDIO; i++)
+  {
+    dup2 (fds [i], i);
+    close (fds [i]);
+  }
+
+  if (g_chdir (cwd) < 0)
+  {
+    int errsv = errno;
+    g_set_error (&tmperr, G_IO_ERROR, g_io_error_from_errno (errsv), "%s: %s", cwd, g_strerror (errsv));
+    goto done;
+  }
+
+  status = main_ ((gint) argc, argv);
+
+  fflush (stdout);
+  fflush (stderr);
+
+  g_data_output_stream_put_int32 (reply, status, NULL, &tmperr);
+  if (G_LIKELY (tmperr == NULL))
+    g_output_stream_flush (G_OUTPUT_STREAM (reply), NULL, &tmperr);
+
+done:
+  if (G_UNLIKELY (tmperr != NULL))
+    g_propagate_error (error, tmperr);
+
+  g_strfreev (argv);
+  g_free (cwd);
+  g_object_unref (reply);
+  g_object_unref (request);
+}
+
+static void
+_reap (void)
+{
+  while (waitpid (-1, NULL, WNOHANG) > 0);
+}
+
+#endif // G_OS_UNIX
+
+void
+server_listen (const gchar* path, ServerMain main_, GError** error)
+{
+#ifndef G_OS_UNIX
+  THROW ("Compile servers are not supported on this platform");
+#else // G_OS_UNIX
+  GSocketListener* listener = g_socket_listener_new ();
+  GSocketAddress* address = g_unix_socket_address_new (path);
+  GSocketConnection* connection = NULL;
+  GError* tmperr = NULL;
+  pid_t pid;
+
+  /*
+   * A socket left behind by a server which did not
+   * exit cleanly would keep this one from binding
+   *
+   */
+  g_unlink (path);
+  g_socket_listener_add_address (listener, address, G_SOCKET_TYPE_STREAM, G_SOCKET_PROTOCOL_DEFAULT, NULL, NULL, &tmperr);
+  g_object_unref (address);
+
+  while (G_LIKELY (tmperr == NULL))
+  {
+    connection = g_socket_listener_accept (listener, NULL, NULL, &tmperr);
+    if (G_UNLIKELY (tmperr != NULL))
+      break;
+
+    _reap ();
+
+    /*
+     * Every request runs on a copy of this process, which
+     * has targets and machine set up already: they are
+     * shared with the server until written to, and a
+     * crashing request takes nothing else down
+     *
+     */
+    if ((pid = fork ()) == 0)
+    {
+      GError* childerr = NULL;
+
+      g_socket_listener_close (listener);
+      _serve (connection, main_, &childerr);
+
+      if (G_UNLIKELY (childerr != NULL))
+      {
+        g_warning ("(%s): %s", G_STRLOC, childerr->message);
+        g_error_free (childerr);
+        _exit (1);
+      }
+
+      _exit (0);
+    }
+    else if (pid < 0)
+    {
+      int errsv = errno;
+      g_warning ("(%s): fork (): %s", G_STRLOC, g_strerror (errsv));
+    }
+
+    g_object_unref (connection);
+  }
+
+  g_socket_listener_close (listener);
+  g_object_unref (listener);
+  g_unlink (path);
+
+  if (G_UNLIKELY (tmperr != NULL))
+    g_propagate_error (error, tmperr);
+#endif // G_OS_UNIX
+}
+
+gint
+server_connect (const gchar* path, gchar** argv, GError** error)
+{
+#ifndef G_OS_UNIX
+  g_set_error
+  (error,
+   BFC_SERVER_ERROR,
+   BFC_SERVER_ERROR_FAILED,
+   "Compile servers are not supported on this platform");
+return -1;
+#else // G_OS_UNIX
+  GSocketClient* client = g_socket_client_new ();
+  GSocketAddress* address = g_unix_socket_address_new (path);
+  GSocketConnection* connection = NULL;
+  GDataOutputStream* request = NULL;
+  GDataInputStream* reply = NULL;
+  GError* tmperr = NULL;
+  gchar* cwd = NULL;
+  gint status = -1;
+  guint i, argc;
+
+  connection = g_socket_client_connect (client, G_SOCKET_CONNECTABLE (address), NULL, &tmperr);
+  g_object_unref (address);
+  g_object_unref (client);
+
+  if (G_UNLIKELY (tmperr != NULL))
+  {
+    g_propagate_error (error, tmperr);
+    return -1;
+  }
+
+  request = g_data_output_stream_new (g_io_stream_get_output_stream (G_IO_STREAM (connection)));
+  reply = g_data_input_stream_new (g_io_stream_get_input_stream (G_IO_STREAM (connection)));
+  g_filter_output_stream_set_close_base_stream (G_FILTER_OUTPUT_STREAM (request), FALSE);
+  g_filter_input_stream_set_close_base_stream (G_FILTER_INPUT_STREAM (reply), FALSE);
+
+  for (i = 0; i < NSTDIO; i++)
+  if (!g_unix_connection_send_fd (G_UNIX_CONNECTION (connection), i, NULL, &tmperr))
+    goto done;
+
+  cwd = g_get_current_dir ();
+  argc = g_strv_length (argv);
+
+  _write_string (request, cwd, &tmperr);
+  if (G_LIKELY (tmperr == NULL))
+    g_data_output_stream_put_uint32 (request, argc, NULL, &tmperr);
+  for (i = 0; i < argc && tmperr == NULL; i++)
+    _write_string (request, argv [i], &tmperr);
+  if (G_LIKELY (tmperr == NULL))
+    g_output_stream_flush (G_OUTPUT_STREAM (request), NULL, &tmperr);
+  if (G_LIKELY (tmperr == NULL))
+    status = g_data_input_stream_read_int32 (reply, NULL, &tmperr);
+
+  /*
+   * A reply cut short means the request died (its
+   * own diagnostics went straight to our streams)
+   *
+   */
+  if (G_UNLIKELY (tmperr != NULL))
+    status = -1;
+
+done:
+  if (G_UNLIKELY (tmperr != NULL))
+    g_propagate_error (error, tmperr);
+
+  g_free (cwd);
+  g_object_unref (reply);
+  g_object_unref (request);
+  g_object_unref (connection);
+return status;
+#endif // G_OS_UNIX
+}
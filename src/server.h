@@ -0,0 +1,35 @@
+/* Copyright 2021-2025 MarcosHCK
+ * This file is part of bfc (BrainFuck Compiler).
+ *
+ * bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with bfc (BrainFuck Compiler).  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __BFC_SERVER__
+#define __BFC_SERVER__ 1
+#include <glib.h>
+
+typedef gint (*ServerMain) (gint argc, gchar** argv);
+
+G_BEGIN_DECLS
+
+G_GNUC_INTERNAL gchar*
+server_socket (void);
+G_GNUC_INTERNAL void
+server_listen (const gchar* path, ServerMain main_, GError** error);
+G_GNUC_INTERNAL gint
+server_connect (const gchar* path, gchar** argv, GError** error);
+
+G_END_DECLS
+
+#endif // __BFC_SERVER__
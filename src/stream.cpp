@@ -22,8 +22,14 @@ using namespace Bfc;
 
 OStream::OStream (GOutputStream* stream)
 {
-  g_assert (G_IS_SEEKABLE (stream));
   this->stream = g_object_ref (stream);
+
+  /*
+   * Writes land in data right away, there is
+   * no point in buffering them twice
+   *
+   */
+  this->SetUnbuffered ();
 }
 
 OStream::OStream (const OStream& stream)
@@ -33,62 +39,44 @@ OStream::OStream (const OStream& stream)
 
 OStream::~OStream ()
 {
-  this->flush ();
   g_object_unref (this->stream);
 }
 
-void
-OStream::pwrite_impl (const char* buffer, size_t size, uint64_t offset)
+gboolean
+OStream::commit (GError** error)
 {
-  if (this->tell () != offset)
-  {
-    this->flush ();
+  GError* tmperr = NULL;
 
-    auto seekable = G_SEEKABLE (stream);
-    if (!g_seekable_can_seek (seekable))
-      g_error ("Unseekable stream");
+  this->flush ();
 
-    GError* tmperr = NULL;
-    g_seekable_seek (seekable, (goffset) offset, G_SEEK_SET, nullptr, &tmperr);
-    if (G_UNLIKELY (tmperr != nullptr))
-    {
-      g_critical
-      ("(%s): %s: %i: %s",
-       G_STRLOC,
-       g_quark_to_string
-       (tmperr->domain),
-        tmperr->code,
-        tmperr->message);
-      g_error_free (tmperr);
-      g_assert_not_reached ();
-    }
+  g_output_stream_write_all (stream, data.data (), data.size (), nullptr, nullptr, &tmperr);
+  if (G_UNLIKELY (tmperr != nullptr))
+  {
+    g_propagate_error (error, tmperr);
+    return FALSE;
   }
 
-  this->write_impl (buffer, size);
+  data.clear ();
+return TRUE;
+}
+
+void
+OStream::pwrite_impl (const char* buffer, size_t size, uint64_t offset)
+{
+  this->flush ();
+
+  g_assert (offset + size <= data.size ());
+  std::copy (buffer, buffer + size, data.begin () + offset);
 }
 
 void
 OStream::write_impl (const char* buffer, size_t size)
 {
-  GError* tmperr = NULL;
-  g_output_stream_write_all (stream, buffer, (gsize) size, nullptr, nullptr, &tmperr);
-  if (G_UNLIKELY (tmperr != nullptr))
-  {
-    g_critical
-    ("(%s): %s: %i: %s",
-     G_STRLOC,
-     g_quark_to_string
-     (tmperr->domain),
-      tmperr->code,
-      tmperr->message);
-    g_error_free (tmperr);
-    g_assert_not_reached ();
-  }
+  data.insert (data.end (), buffer, buffer + size);
 }
 
 uint64_t
 OStream::current_pos () const
 {
-  auto seekable = G_SEEKABLE (stream);
-  return (uint64_t) g_seekable_tell (seekable);
+  return (uint64_t) data.size ();
 }
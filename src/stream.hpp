@@ -19,9 +19,16 @@
 #define __ASM_STREAM__ 1
 #include <llvm/Support/raw_ostream.h>
 #include <gio/gio.h>
+#include <vector>
 
 namespace Bfc
 {
+  /*
+   * Collects everything written (back-patches included) in
+   * memory, and hands it to the underlying stream in one go on
+   * commit, so it needs not be seekable (pipes are fine)
+   *
+   */
   class OStream : public llvm::raw_pwrite_stream
   {
   public:
@@ -29,11 +36,14 @@ namespace Bfc
     OStream (const OStream& stream);
     ~OStream ();
 
+    gboolean commit (GError** error);
+
     virtual void pwrite_impl (const char* buffer, size_t size, uint64_t offset) override;
     virtual void write_impl (const char* Ptr, size_t Size) override;
     virtual uint64_t current_pos () const override;
   private:
     GOutputStream *stream;
+    std::vector<char> data;
   };
 }
 
@@ -0,0 +1,71 @@
+#!/bin/sh
+# Copyright 2021-2025 MarcosHCK
+# This file is part of bfc (BrainFuck Compiler).
+#
+# bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with bfc (BrainFuck Compiler). If not, see <http://www.gnu.org/licenses/>.
+#
+
+#
+# A compilation cached with --cache (a miss) must be reused
+# as is by the next one (a hit), and --cache-stats must count
+# both. Entries left half stored take their room until they
+# grow stale, and are swept away then
+#
+
+BFC=${BFC:-bfc}
+dir=`mktemp -d` || exit 99
+trap 'rm -rf "$dir"' EXIT
+
+cache="$dir/cache"
+status=0
+
+fail ()
+{
+  echo "FAIL: $*"
+  status=1
+}
+
+count ()
+{
+  "$BFC" --cache-dir="$cache" --cache-stats > "$dir/stats" || exit 99
+  sed -n "s/^$1: \([0-9]*\).*/\1/p" "$dir/stats"
+}
+
+printf '%s' '++++++++[>++++[>++>+++>+++>+<<<<-]>+>+>->>+[<]<-]>>.>---.+++++++..+++.>>.<-.<.+++.------.--------.>>+.' > "$dir/prog.b"
+
+for run in 1 2
+do
+  "$BFC" --cache --cache-dir="$cache" -o "$dir/prog$run" "$dir/prog.b" || exit 99
+  "$dir/prog$run" < /dev/null > "$dir/out$run" || fail "run $run exited $?"
+done
+
+cmp -s "$dir/prog1" "$dir/prog2" || fail 'a hit does not give what the miss compiled'
+cmp -s "$dir/out1" "$dir/out2" || fail 'a hit does not run as the miss did'
+
+test "`count misses`" = 1 || fail "`count misses` misses counted, instead of 1"
+test "`count hits`" = 1 || fail "`count hits` hits counted, instead of 1"
+test "`count entries`" = 1 || fail "`count entries` entries listed, instead of 1"
+
+key=`ls "$cache" | sed -n '/^[0-9a-f]*$/p'`
+size=`count size`
+
+cp "$dir/prog.b" "$cache/$key.0000beef"
+cp "$dir/prog.b" "$cache/$key.0000dead"
+touch -t 200001010000 "$cache/$key.0000dead"
+
+test "`count size`" = `expr $size + \`wc -c < "$dir/prog.b"\`` || fail 'entries being stored take no room'
+test -f "$cache/$key.0000beef" || fail 'an entry being stored was swept away'
+test -f "$cache/$key.0000dead" && fail 'an abandoned entry was not swept away'
+
+exit $status
@@ -0,0 +1,74 @@
+#!/bin/sh
+# Copyright 2021-2025 MarcosHCK
+# This file is part of bfc (BrainFuck Compiler).
+#
+# bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with bfc (BrainFuck Compiler). If not, see <http://www.gnu.org/licenses/>.
+#
+
+#
+# With --check-belt, optimized programs must trap where
+# unoptimized ones do, and compiled programs where the
+# interpreter does: same output, same exit status (the
+# interpreter reports traps as errors)
+#
+
+BFC=${BFC:-bfc}
+dir=`mktemp -d` || exit 99
+trap 'rm -rf "$dir"' EXIT
+
+status=0
+
+check ()
+{
+  printf '%s' "$1" > "$dir/prog.b"
+  shift
+
+  for level in 0 2
+  do
+    "$BFC" -O$level --check-belt "$@" -o "$dir/prog$level" "$dir/prog.b" || exit 99
+    "$dir/prog$level" < /dev/null > "$dir/out$level"
+    echo $? > "$dir/status$level"
+  done
+
+  if "$BFC" --interpret --check-belt "$@" "$dir/prog.b" < /dev/null > "$dir/outi" 2> /dev/null
+  then
+    echo 0 > "$dir/statusi"
+  else
+    echo 254 > "$dir/statusi"
+  fi
+
+  if ! cmp -s "$dir/out0" "$dir/out2" || ! cmp -s "$dir/status0" "$dir/status2"
+  then
+    echo "FAIL: '`cat "$dir/prog.b"`' $*: -O0 exited `cat "$dir/status0"`, -O2 exited `cat "$dir/status2"`"
+    status=1
+  fi
+
+  if ! cmp -s "$dir/out0" "$dir/outi" || ! cmp -s "$dir/status0" "$dir/statusi"
+  then
+    echo "FAIL: '`cat "$dir/prog.b"`' $*: compiled and interpreted runs differ"
+    status=1
+  fi
+}
+
+for steps in 0 1000000
+do
+  check '+>+<.>.>.' --belt-size=2 --eval-steps=$steps
+  check '++++++++[>++++++++<-]>+.>+.>+.' --belt-size=2 --eval-steps=$steps
+  check '+.>+.>+.<<<+.' --belt-size=3 --eval-steps=$steps
+  check ',+[[-].>+.>+.]' --belt-size=2 --eval-steps=$steps
+  check ',+[.>>>+<<<-]' --belt-size=2 --eval-steps=$steps
+  check ',+[>[>>>>+<<<<--]<-].' --belt-size=2 --eval-steps=$steps
+done
+
+exit $status
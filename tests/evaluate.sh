@@ -0,0 +1,65 @@
+#!/bin/sh
+# Copyright 2021-2025 MarcosHCK
+# This file is part of bfc (BrainFuck Compiler).
+#
+# bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with bfc (BrainFuck Compiler). If not, see <http://www.gnu.org/licenses/>.
+#
+
+#
+# Compile-time evaluation must not change what programs
+# output, wherever it stops: here, partway through writes of
+# several cells at once (on the belt edge, or past the cells
+# the step budget allows)
+#
+
+BFC=${BFC:-bfc}
+dir=`mktemp -d` || exit 99
+trap 'rm -rf "$dir"' EXIT
+
+status=0
+
+run ()
+{
+  steps=$1
+  shift
+
+  "$BFC" -O2 --eval-steps=$steps "$@" -o "$dir/prog" "$dir/prog.b" || exit 99
+  "$dir/prog" < /dev/null > "$dir/out$steps"
+  echo $? > "$dir/status$steps"
+}
+
+check ()
+{
+  printf '%s' "$1" > "$dir/prog.b"
+  shift
+
+  run 0 "$@"
+
+  for steps in 1 2 3 4 5 6 7 8 1000000
+  do
+    run $steps "$@"
+
+    if ! cmp -s "$dir/out0" "$dir/out$steps" || ! cmp -s "$dir/status0" "$dir/status$steps"
+    then
+      echo "FAIL: '`cat "$dir/prog.b"`' $* --eval-steps=$steps: output differs from --eval-steps=0"
+      status=1
+    fi
+  done
+}
+
+check '+>++>+++<<.>.>.>.' --check-belt --belt-size=3
+check '+.>.>.>.>.>.>.>.'
+check '+>++>+++>++++<<<.>.>.>.>.>.>.>.'
+
+exit $status
@@ -0,0 +1,114 @@
+#!/bin/sh
+# Copyright 2021-2025 MarcosHCK
+# This file is part of bfc (BrainFuck Compiler).
+#
+# bfc (BrainFuck Compiler) is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# bfc (BrainFuck Compiler) is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with bfc (BrainFuck Compiler). If not, see <http://www.gnu.org/licenses/>.
+#
+
+#
+# Programs must behave the same interpreted from source, from
+# a bytecode image and compiled: same output, and failing
+# (the interpreter reports traps as errors) or not alike.
+# Damaged images must be refused rather than run
+#
+
+BFC=${BFC:-bfc}
+dir=`mktemp -d` || exit 99
+trap 'rm -rf "$dir"' EXIT
+
+status=0
+
+check ()
+{
+  printf '%s' "$1" > "$dir/prog.b"
+  printf '%s' "$2" > "$dir/in"
+  shift 2
+
+  "$BFC" "$@" -o "$dir/prog" "$dir/prog.b" || exit 99
+  "$BFC" "$@" --emit-bytecode -o "$dir/prog.bfcb" "$dir/prog.b" || exit 99
+
+  "$dir/prog" < "$dir/in" > "$dir/out0"
+  test $? -eq 0; echo $? > "$dir/status0"
+  "$BFC" "$@" --interpret "$dir/prog.b" < "$dir/in" > "$dir/out1" 2> /dev/null
+  test $? -eq 0; echo $? > "$dir/status1"
+  "$BFC" --interpret "$dir/prog.bfcb" < "$dir/in" > "$dir/out2" 2> /dev/null
+  test $? -eq 0; echo $? > "$dir/status2"
+
+  for run in 1 2
+  do
+    if ! cmp -s "$dir/out0" "$dir/out$run" || ! cmp -s "$dir/status0" "$dir/status$run"
+    then
+      test $run -eq 1 && how='from source' || how='from bytecode'
+      echo "FAIL: '`cat "$dir/prog.b"`' $*: compiled and interpreted ($how) runs differ"
+      status=1
+    fi
+  done
+}
+
+#
+# Copies the image of the last program checked, with the byte
+# at offset replaced, or cut short at length
+#
+patch ()
+{
+  cp "$dir/prog.bfcb" "$dir/bad.bfcb"
+  printf "$2" | dd of="$dir/bad.bfcb" bs=1 seek=$1 conv=notrunc 2> /dev/null
+}
+
+cut ()
+{
+  head -c $1 "$dir/prog.bfcb" > "$dir/bad.bfcb"
+}
+
+refuse ()
+{
+  if "$BFC" --interpret "$dir/bad.bfcb" < "$dir/in" > "$dir/out" 2> /dev/null || test -s "$dir/out"
+  then
+    echo "FAIL: $*: damaged image was run"
+    status=1
+  fi
+}
+
+hello='++++++++[>++++[>++>+++>+++>+<<<<-]>+>+>->>+[<]<-]>>.>---.+++++++..+++.>>.<-.<.+++.------.--------.>>+.'
+wide='++++++++[>++++++++<-]>[<++++>-]<[[-]>+++++++++++++++++++++++++++++++++.<]'
+
+for flags in '' '--belt-wrap --belt-size=8' '--check-belt --belt-size=4' '--cell-bits=16' '--cell-bits=32' '--cell-bits=64'
+do
+  for steps in 0 1000000
+  do
+    check "$hello" '' $flags --eval-steps=$steps
+    check "$wide" '' $flags --eval-steps=$steps
+    check ',[+.[-],]' 'abc' $flags --eval-steps=$steps
+    check '>,[.>,]<[.<]' 'abcdef' $flags --eval-steps=$steps
+    check '-[>+<-]>[<+++>-]<.' '' $flags --eval-steps=$steps
+  done
+done
+
+#
+# Offsets follow Bfc::Header and Bfc::Insn: the version at 4,
+# the cell width at 8, then instructions from 64 on, 24 bytes
+# each, with their code first and their jump at 12 (the op_open
+# of this program is the second one). Images cut within their
+# header are not told from sources, so they are not tried
+#
+check ',[.[-],]' 'abc'
+
+cut 100; refuse 'cut within its instructions'
+cut `expr \`wc -c < "$dir/prog.bfcb"\` - 1`; refuse 'cut within its data'
+patch 4 '\177'; refuse 'wrong version'
+patch 8 '\007'; refuse 'wrong cell width'
+patch 64 '\177'; refuse 'wrong opcode'
+patch 100 '\000'; refuse 'unbalanced jump'
+
+exit $status